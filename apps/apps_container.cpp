@@ -6,6 +6,7 @@
 #include <ion.h>
 #include <poincare/init.h>
 #include <poincare/exception_checkpoint.h>
+#include <python/port/port.h>
 #include "global_preferences.h"
 #include "shared/record_restrictive_extensions_helper.h"
 
@@ -137,6 +138,8 @@ bool AppsContainer::processEvent(Ion::Events::Event event) {
         updateBatteryState();
         switchToBuiltinApp(usbConnectedAppSnapshot());
         Ion::USB::DFU();
+        // The storage may have been written during DFU
+        Ion::Storage::FileSystem::sharedFileSystem()->reloadAfterExternalChange();
         // Update LED when exiting DFU mode
         Ion::LED::updateColorWithPlugAndCharge();
         switchToBuiltinApp(activeSnapshot);
@@ -383,6 +386,10 @@ void AppsContainer::storageIsFull() {
   }
 }
 
+bool AppsContainer::storageCanFreeSpace(const Ion::Storage::Record recordToKeep) {
+  return MicroPython::destroyCompiledScripts(recordToKeep);
+}
+
 Window * AppsContainer::window() {
   return &m_window;
 }
@@ -56,6 +56,7 @@ public:
   // Ion::Storage::StorageDelegate
   void storageDidChangeForRecord(const Ion::Storage::Record record) override;
   void storageIsFull() override;
+  bool storageCanFreeSpace(const Ion::Storage::Record recordToKeep) override;
 protected:
   int numberOfExternalApps() { return Ion::ExternalApps::numberOfApps(); }
 private:
@@ -127,8 +127,19 @@ Layout Calculation::createApproximateOutputLayout(bool * couldNotCreateApproxima
   return Layout();
 }
 
-KDCoordinate Calculation::height(bool expanded) {
+KDCoordinate Calculation::height(bool expanded, HeightComputer heightComputer) {
   KDCoordinate h = expanded ? m_expandedHeight : m_height;
+  if (h == k_unknownHeight) {
+    /* Heights are reset when the preferences change and only computed again
+     * when the row is laid out. The void context is used since there is no
+     * reasons for the heightComputer to resolve symbols. */
+    h = heightComputer(this, nullptr, expanded);
+    if (expanded) {
+      m_expandedHeight = h;
+    } else {
+      m_height = h;
+    }
+  }
   assert(h >= 0);
   return h;
 }
@@ -46,6 +46,7 @@ public:
     Complex
   };
   static bool DisplaysExact(DisplayOutput d) { return d != DisplayOutput::ApproximateOnly; }
+  typedef KDCoordinate (*HeightComputer)(Calculation * c, Poincare::Context * context, bool expanded);
 
   /* It is not really the minimal size, but it clears enough space for most
    * calculations instead of clearing less space, then fail to serialize, clear
@@ -55,8 +56,8 @@ public:
 
   Calculation() :
     m_displayOutput(DisplayOutput::Unknown),
-    m_height(-1),
-    m_expandedHeight(-1),
+    m_height(k_unknownHeight),
+    m_expandedHeight(k_unknownHeight),
     m_equalSign(EqualSign::Unknown)
   {
     assert(sizeof(m_inputText) == 0);
@@ -85,7 +86,9 @@ public:
   Poincare::Layout createApproximateOutputLayout(bool * couldNotCreateApproximateLayout);
 
   // Heights
-  KDCoordinate height(bool expanded);
+  KDCoordinate height(bool expanded, HeightComputer heightComputer);
+  void resetHeights() { setHeights(k_unknownHeight, k_unknownHeight); }
+  bool heightIsKnown(bool expanded) const { return (expanded ? m_expandedHeight : m_height) != k_unknownHeight; }
 
   // Displayed output
   DisplayOutput displayOutput(Poincare::Context * context);
@@ -97,6 +100,7 @@ public:
   AdditionalInformationType additionalInformationType();
 private:
   static constexpr KDCoordinate k_heightComputationFailureHeight = 50;
+  static constexpr KDCoordinate k_unknownHeight = -1;
   static constexpr const char * k_maximalIntegerWithAdditionalInformation = "10000000000000000";
 
   void setHeights(KDCoordinate height, KDCoordinate expandedHeight);
@@ -286,13 +286,9 @@ Expression CalculationStore::ansExpression(Context * context) {
   return exactOutput;
 }
 
-void CalculationStore::recomputeHeights(HeightComputer heightComputer) {
+void CalculationStore::resetHeights() {
   for (Calculation * calculation : *this) {
-    calculation->setHeights(
-      /* The void context is used since there is no reasons for the
-       * heightComputer to resolve symbols */
-      heightComputer(calculation, nullptr, false),
-      heightComputer(calculation, nullptr, true));
+    calculation->resetHeights();
   }
 }
 
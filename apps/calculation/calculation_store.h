@@ -35,7 +35,7 @@ class CalculationStore {
 public:
   CalculationStore();
   CalculationStore(char * buffer, int size);
-  typedef KDCoordinate (*HeightComputer)(Calculation * c, Poincare::Context * context, bool expanded);
+  typedef Calculation::HeightComputer HeightComputer;
   Shared::ExpiringPointer<Calculation> push(const char * text, Poincare::Context * context, HeightComputer heightComputer);
 
   Shared::ExpiringPointer<Calculation> calculationAtIndex(int i);
@@ -45,7 +45,7 @@ public:
   int remainingBufferSize() const { assert(m_calculationAreaEnd >= m_buffer); return m_bufferSize - (m_calculationAreaEnd - m_buffer) - m_numberOfCalculations*sizeof(Calculation*); }
   int numberOfCalculations() const { return m_numberOfCalculations; }
   Poincare::Expression ansExpression(Poincare::Context * context);
-  void recomputeHeights(HeightComputer heightComputer);
+  void resetHeights();
   bool preferencesMightHaveChanged(Poincare::Preferences * preferences);
 
 private:
@@ -133,6 +133,7 @@ bool EditExpressionController::inputViewDidReceiveEvent(Ion::Events::Event event
     if (!myApp->isAcceptableText(m_cacheBuffer)) {
       return true;
     }
+    m_historyController->clearLayoutCache();
     if (m_calculationStore->push(m_cacheBuffer, myApp->localContext(), HistoryViewCell::Height).pointer()) {
       m_historyController->reload();
       return true;
@@ -162,6 +163,7 @@ bool EditExpressionController::inputViewDidFinishEditing(const char * text, Layo
   } else {
     layoutR.serializeParsedExpression(m_cacheBuffer, k_cacheBufferSize, context);
   }
+  m_historyController->clearLayoutCache();
   if (m_calculationStore->push(m_cacheBuffer, context, HistoryViewCell::Height).pointer()) {
     m_historyController->reload();
     m_contentView.expressionField()->setEditing(true, true);
@@ -34,6 +34,7 @@ void HistoryController::reload() {
   for (int i = 0; i < k_maxNumberOfDisplayedRows; i++) {
     m_calculationHistory[i].resetMemoization();
   }
+  m_layoutCache.clear();
 
   m_selectableTableView.reloadData();
   /* TODO
@@ -63,6 +64,8 @@ void HistoryController::willExitResponderChain(Responder * nextFirstResponder) {
   }
   if (nextFirstResponder == parentResponder()) {
     m_selectableTableView.deselectTable();
+    // Make room in the pool for the edited calculation
+    m_layoutCache.clear();
   }
 }
 
@@ -205,7 +208,7 @@ int HistoryController::reusableCellCount(int type) {
 void HistoryController::willDisplayCellForIndex(HighlightCell * cell, int index) {
   HistoryViewCell * myCell = static_cast<HistoryViewCell *>(cell);
   Poincare::Context * context = App::app()->localContext();
-  myCell->setCalculation(calculationAtIndex(index).pointer(), index == selectedRow() && selectedSubviewType() == SubviewType::Output, context);
+  myCell->setCalculation(calculationAtIndex(index).pointer(), index == selectedRow() && selectedSubviewType() == SubviewType::Output, context, false, &m_layoutCache);
   myCell->setEven(index%2 == 0);
   myCell->reloadSubviewHighlight();
 }
@@ -216,7 +219,12 @@ KDCoordinate HistoryController::rowHeight(int j) {
   }
   Shared::ExpiringPointer<Calculation> calculation = calculationAtIndex(j);
   bool expanded = j == selectedRow() && selectedSubviewType() == SubviewType::Output;
-  return calculation->height(expanded);
+  if (!calculation->heightIsKnown(expanded)) {
+    /* The height depends on the room left in the pool, so it is computed
+     * without the cached layouts, as in CalculationStore::push. */
+    clearLayoutCache();
+  }
+  return calculation->height(expanded, HistoryViewCell::Height);
 }
 
 bool HistoryController::calculationAtIndexToggles(int index) {
@@ -256,9 +264,10 @@ void HistoryController::historyViewCellDidChangeSelection(HistoryViewCell ** cel
   }
 }
 
-void HistoryController::recomputeHistoryCellHeightsIfNeeded() {
+void HistoryController::resetHistoryCellHeightsIfNeeded() {
   if (m_calculationStore->preferencesMightHaveChanged(Poincare::Preferences::sharedPreferences())) {
-    m_calculationStore->recomputeHeights(HistoryViewCell::Height);
+    // Heights are computed again when rows are laid out
+    m_calculationStore->resetHeights();
   };
 }
 
@@ -32,7 +32,10 @@ public:
   KDCoordinate rowHeight(int j) override;
   void setSelectedSubviewType(SubviewType subviewType, bool sameCell, int previousSelectedX = -1, int previousSelectedY = -1) override;
   void tableViewDidChangeSelectionAndDidScroll(Escher::SelectableTableView * t, int previousSelectedCellX, int previousSelectedCellY, bool withinTemporarySelection = false) override;
-  void recomputeHistoryCellHeightsIfNeeded();
+  void resetHistoryCellHeightsIfNeeded();
+  /* The heights of the calculations depend on the room left in the pool, so
+   * the cached layouts are dropped before they are computed. */
+  void clearLayoutCache() { m_layoutCache.clear(); }
 private:
   int storeIndex(int i) { return numberOfRows() - i - 1; }
   Shared::ExpiringPointer<Calculation> calculationAtIndex(int i);
@@ -42,6 +45,7 @@ private:
   constexpr static int k_maxNumberOfDisplayedRows = 8;
   CalculationSelectableTableView m_selectableTableView;
   HistoryViewCell m_calculationHistory[k_maxNumberOfDisplayedRows];
+  HistoryLayoutCache m_layoutCache;
   CalculationStore * m_calculationStore;
   ComplexListController m_complexController;
   IntegerListController m_integerController;
@@ -0,0 +1,53 @@
+#include "history_layout_cache.h"
+
+using namespace Poincare;
+
+namespace Calculation {
+
+void HistoryLayoutCache::Entry::setLayouts(uint32_t calculationCRC32, Layout inputLayout, Layout exactOutputLayout, Layout approximateOutputLayout, Calculation::AdditionalInformationType additionalInformationType) {
+  m_calculationCRC32 = calculationCRC32;
+  m_inputLayout = inputLayout;
+  m_exactOutputLayout = exactOutputLayout;
+  m_approximateOutputLayout = approximateOutputLayout;
+  m_additionalInformationType = additionalInformationType;
+}
+
+void HistoryLayoutCache::Entry::reset() {
+  m_calculationCRC32 = 0;
+  m_inputLayout = Layout();
+  m_exactOutputLayout = Layout();
+  m_approximateOutputLayout = Layout();
+  m_additionalInformationType = Calculation::AdditionalInformationType::None;
+}
+
+HistoryLayoutCache::Entry * HistoryLayoutCache::entryForCalculation(uint32_t calculationCRC32, bool * found) {
+  Entry * entry = nullptr;
+  *found = false;
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    if (!m_entries[i].isEmpty() && m_entries[i].m_calculationCRC32 == calculationCRC32) {
+      entry = m_entries + i;
+      *found = true;
+      break;
+    }
+  }
+  if (entry == nullptr) {
+    // Replace an empty entry or else the least recently used one
+    entry = m_entries;
+    for (int i = 1; i < k_numberOfEntries && !entry->isEmpty(); i++) {
+      if (m_entries[i].isEmpty() || m_entries[i].m_lastAccess < entry->m_lastAccess) {
+        entry = m_entries + i;
+      }
+    }
+    entry->reset();
+  }
+  entry->m_lastAccess = ++m_numberOfAccesses;
+  return entry;
+}
+
+void HistoryLayoutCache::clear() {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    m_entries[i].reset();
+  }
+}
+
+}
@@ -0,0 +1,58 @@
+#ifndef CALCULATION_HISTORY_LAYOUT_CACHE_H
+#define CALCULATION_HISTORY_LAYOUT_CACHE_H
+
+#include "calculation.h"
+#include <poincare/layout.h>
+
+namespace Calculation {
+
+/* HistoryLayoutCache keeps the layouts of the last calculations displayed in
+ * the history, so that scrolling back to them does not parse their texts and
+ * create their layouts again.
+ *
+ * Entries are keyed by the CRC32 of the calculation, which covers its texts and
+ * its display output, and the least recently used one is replaced on a miss.
+ * The layouts live in the Poincare pool: the cache is cleared whenever the
+ * history is reloaded or left, which also happens after the preferences
+ * change, and when the layouts of a calculation cannot be created next to the
+ * cached ones. */
+
+class HistoryLayoutCache {
+public:
+  class Entry {
+  friend class HistoryLayoutCache;
+  public:
+    Entry() : m_calculationCRC32(0), m_lastAccess(0), m_additionalInformationType(Calculation::AdditionalInformationType::None) {}
+    void setLayouts(uint32_t calculationCRC32, Poincare::Layout inputLayout, Poincare::Layout exactOutputLayout, Poincare::Layout approximateOutputLayout, Calculation::AdditionalInformationType additionalInformationType);
+    Poincare::Layout inputLayout() const { return m_inputLayout; }
+    Poincare::Layout exactOutputLayout() const { return m_exactOutputLayout; }
+    Poincare::Layout approximateOutputLayout() const { return m_approximateOutputLayout; }
+    Calculation::AdditionalInformationType additionalInformationType() const { return m_additionalInformationType; }
+  private:
+    bool isEmpty() const { return m_calculationCRC32 == 0; }
+    void reset();
+    uint32_t m_calculationCRC32;
+    uint32_t m_lastAccess;
+    Poincare::Layout m_inputLayout;
+    Poincare::Layout m_exactOutputLayout;
+    Poincare::Layout m_approximateOutputLayout;
+    Calculation::AdditionalInformationType m_additionalInformationType;
+  };
+
+  HistoryLayoutCache() : m_numberOfAccesses(0) {}
+
+  /* Return the entry of the calculation, setting found if it holds its layouts.
+   * Otherwise, the entry returned is emptied, which releases its layouts before
+   * the new ones are created, and the caller can fill it with setLayouts. */
+  Entry * entryForCalculation(uint32_t calculationCRC32, bool * found);
+  void clear();
+
+private:
+  constexpr static int k_numberOfEntries = 8;
+  Entry m_entries[k_numberOfEntries];
+  uint32_t m_numberOfAccesses;
+};
+
+}
+
+#endif
@@ -239,30 +239,14 @@ void HistoryViewCell::resetMemoization() {
   m_calculationCRC32 = 0;
 }
 
-void HistoryViewCell::setCalculation(Calculation * calculation, bool expanded, Poincare::Context * context, bool canChangeDisplayOutput) {
-  uint32_t newCalculationCRC = Ion::crc32Byte((const uint8_t *)calculation, ((char *)calculation->next()) - ((char *) calculation));
-  if (newCalculationCRC == m_calculationCRC32 && m_calculationExpanded == expanded) {
-    return;
-  }
-
-  // TODO: maybe do this only when the layout won't change to avoid blinking
-  resetMemoization();
-
-  // Memoization
-  m_calculationCRC32 = newCalculationCRC;
-  m_calculationExpanded = expanded && calculation->displayOutput(context) == ::Calculation::Calculation::DisplayOutput::ExactAndApproximateToggle;
+void HistoryViewCell::createLayouts(Calculation * calculation, Poincare::Context * context, bool canChangeDisplayOutput, Poincare::Layout * exactOutputLayout, Poincare::Layout * approximateOutputLayout) {
   m_calculationAdditionInformation = calculation->additionalInformationType();
   m_inputView.setLayout(calculation->createInputLayout());
 
-  /* All expressions have to be updated at the same time. Otherwise,
-   * when updating one layout, if the second one still points to a deleted
-   * layout, calling to layoutSubviews() would fail. */
-
   // Create the exact output layout
-  Poincare::Layout exactOutputLayout = Poincare::Layout();
   if (Calculation::DisplaysExact(calculation->displayOutput(context))) {
     bool couldNotCreateExactLayout = false;
-    exactOutputLayout = calculation->createExactOutputLayout(&couldNotCreateExactLayout);
+    *exactOutputLayout = calculation->createExactOutputLayout(&couldNotCreateExactLayout);
     if (couldNotCreateExactLayout) {
       if (canChangeDisplayOutput && calculation->displayOutput(context) != ::Calculation::Calculation::DisplayOutput::ExactOnly) {
         calculation->forceDisplayOutput(::Calculation::Calculation::DisplayOutput::ApproximateOnly);
@@ -278,27 +262,26 @@ void HistoryViewCell::setCalculation(Calculation * calculation, bool expanded, P
       + 2 * KDFont::LargeFont->glyphSize().width()); // > arrow and = sign
     if (canChangeDisplayOutput
      && calculation->displayOutput(context) == ::Calculation::Calculation::DisplayOutput::ExactAndApproximate
-     && exactOutputLayout.layoutSize().width() > maxVisibleWidth)
+     && exactOutputLayout->layoutSize().width() > maxVisibleWidth)
     {
       calculation->forceDisplayOutput(::Calculation::Calculation::DisplayOutput::ExactAndApproximateToggle);
     }
   }
 
   // Create the approximate output layout
-  Poincare::Layout approximateOutputLayout;
   if (calculation->displayOutput(context) == ::Calculation::Calculation::DisplayOutput::ExactOnly) {
-    approximateOutputLayout = exactOutputLayout;
+    *approximateOutputLayout = *exactOutputLayout;
   } else {
     bool couldNotCreateApproximateLayout = false;
-    approximateOutputLayout = calculation->createApproximateOutputLayout(&couldNotCreateApproximateLayout);
+    *approximateOutputLayout = calculation->createApproximateOutputLayout(&couldNotCreateApproximateLayout);
     if (couldNotCreateApproximateLayout) {
       if (canChangeDisplayOutput && calculation->displayOutput(context) != ::Calculation::Calculation::DisplayOutput::ApproximateOnly) {
         /* Set the display output to ApproximateOnly, make room in the pool by
          * erasing the exact layout, and retry to create the approximate layout */
         calculation->forceDisplayOutput(::Calculation::Calculation::DisplayOutput::ApproximateOnly);
-        exactOutputLayout = Poincare::Layout();
+        *exactOutputLayout = Poincare::Layout();
         couldNotCreateApproximateLayout = false;
-        approximateOutputLayout = calculation->createApproximateOutputLayout(&couldNotCreateApproximateLayout);
+        *approximateOutputLayout = calculation->createApproximateOutputLayout(&couldNotCreateApproximateLayout);
         if (couldNotCreateApproximateLayout) {
           Poincare::ExceptionCheckpoint::Raise();
         }
@@ -307,6 +290,58 @@ void HistoryViewCell::setCalculation(Calculation * calculation, bool expanded, P
       }
     }
   }
+}
+
+void HistoryViewCell::setCalculation(Calculation * calculation, bool expanded, Poincare::Context * context, bool canChangeDisplayOutput, HistoryLayoutCache * layoutCache) {
+  uint32_t newCalculationCRC = Ion::crc32Byte((const uint8_t *)calculation, ((char *)calculation->next()) - ((char *) calculation));
+  if (newCalculationCRC == m_calculationCRC32 && m_calculationExpanded == expanded) {
+    return;
+  }
+
+  // TODO: maybe do this only when the layout won't change to avoid blinking
+  resetMemoization();
+
+  // Memoization
+  m_calculationCRC32 = newCalculationCRC;
+  m_calculationExpanded = expanded && calculation->displayOutput(context) == ::Calculation::Calculation::DisplayOutput::ExactAndApproximateToggle;
+
+  /* All expressions have to be updated at the same time. Otherwise,
+   * when updating one layout, if the second one still points to a deleted
+   * layout, calling to layoutSubviews() would fail. */
+  Poincare::Layout exactOutputLayout;
+  Poincare::Layout approximateOutputLayout;
+  bool cached = false;
+  HistoryLayoutCache::Entry * cacheEntry = layoutCache ? layoutCache->entryForCalculation(newCalculationCRC, &cached) : nullptr;
+  if (cached) {
+    m_calculationAdditionInformation = cacheEntry->additionalInformationType();
+    m_inputView.setLayout(cacheEntry->inputLayout());
+    exactOutputLayout = cacheEntry->exactOutputLayout();
+    approximateOutputLayout = cacheEntry->approximateOutputLayout();
+  } else if (cacheEntry) {
+    assert(!canChangeDisplayOutput);
+    /* The cached layouts take room in the pool. If the layouts of the
+     * calculation cannot be created next to them, the cache is emptied and
+     * they are created again. */
+    bool createdLayouts = false;
+    {
+      Poincare::ExceptionCheckpoint ecp;
+      if (ExceptionRun(ecp)) {
+        createLayouts(calculation, context, canChangeDisplayOutput, &exactOutputLayout, &approximateOutputLayout);
+        createdLayouts = !m_inputView.layout().isUninitialized();
+      }
+    }
+    if (!createdLayouts) {
+      m_inputView.setLayout(Poincare::Layout());
+      exactOutputLayout = Poincare::Layout();
+      approximateOutputLayout = Poincare::Layout();
+      layoutCache->clear();
+      createLayouts(calculation, context, canChangeDisplayOutput, &exactOutputLayout, &approximateOutputLayout);
+    }
+    cacheEntry->setLayouts(newCalculationCRC, m_inputView.layout(), exactOutputLayout, approximateOutputLayout, m_calculationAdditionInformation);
+  } else {
+    createLayouts(calculation, context, canChangeDisplayOutput, &exactOutputLayout, &approximateOutputLayout);
+  }
+
   m_calculationDisplayOutput = calculation->displayOutput(context);
 
   // We must set which subviews are displayed before setLayouts to mark the right rectangle as dirty
@@ -2,6 +2,7 @@
 #define CALCULATION_HISTORY_VIEW_CELL_H
 
 #include "calculation.h"
+#include "history_layout_cache.h"
 #include "../shared/scrollable_multiple_expressions_view.h"
 #include <escher/scrollable_expression_view.h>
 #include <escher/even_odd_cell_with_ellipsis.h>
@@ -52,7 +53,8 @@ public:
   Poincare::Layout layout() const override;
   KDColor backgroundColor() const override { return m_even ? KDColorWhite : Escher::Palette::WallScreen; }
   void resetMemoization();
-  void setCalculation(Calculation * calculation, bool expanded, Poincare::Context * context, bool canChangeDisplayOutput = false);
+  // Layouts are taken from and added to layoutCache if it is provided
+  void setCalculation(Calculation * calculation, bool expanded, Poincare::Context * context, bool canChangeDisplayOutput = false, HistoryLayoutCache * layoutCache = nullptr);
   int numberOfSubviews() const override { return 2 + displayedEllipsis(); }
   View * subviewAtIndex(int index) override;
   void layoutSubviews(bool force = false) override;
@@ -65,6 +67,7 @@ private:
   constexpr static KDCoordinate k_resultWidth = 80;
   void computeSubviewFrames(KDCoordinate frameWidth, KDCoordinate frameHeight, KDRect * ellipsisFrame, KDRect * inputFrame, KDRect * outputFrame);
   void reloadScroll();
+  void createLayouts(Calculation * calculation, Poincare::Context * context, bool canChangeDisplayOutput, Poincare::Layout * exactOutputLayout, Poincare::Layout * approximateOutputLayout);
   void reloadOutputSelection(HistoryViewCellDataSource::SubviewType previousType);
   bool displayedEllipsis() const {
     return m_highlighted && m_calculationAdditionInformation != Calculation::AdditionalInformationType::None;
@@ -3,9 +3,11 @@
 #include <poincare/test/helper.h>
 #include <poincare/preferences.h>
 #include <poincare_expressions.h>
+#include <poincare_layouts.h>
 #include <string.h>
 #include <assert.h>
 #include "../calculation_store.h"
+#include "../history_layout_cache.h"
 #include "../../exam_mode_configuration.h"
 
 typedef ::Calculation::Calculation::AdditionalInformationType AdditionalInformationType;
@@ -121,6 +123,63 @@ QUIZ_CASE(calculation_store) {
   quiz_assert(store.remainingBufferSize() == store.bufferSize());
 }
 
+static int sNumberOfComputedHeights = 0;
+
+KDCoordinate countingHeight(::Calculation::Calculation * c, Poincare::Context * context, bool expanded) {
+  sNumberOfComputedHeights++;
+  return expanded ? 20 : 10;
+}
+
+QUIZ_CASE(calculation_store_heights) {
+  Shared::GlobalContext globalContext;
+  CalculationStore store(calculationBuffer,calculationBufferSize);
+  sNumberOfComputedHeights = 0;
+  store.push("1+1", &globalContext, countingHeight);
+  store.push("2+2", &globalContext, countingHeight);
+  quiz_assert(sNumberOfComputedHeights == 4);
+
+  // Reset heights are only computed again when they are needed
+  store.resetHeights();
+  quiz_assert(sNumberOfComputedHeights == 4);
+  quiz_assert(!store.calculationAtIndex(0)->heightIsKnown(false));
+  quiz_assert(store.calculationAtIndex(0)->height(false, countingHeight) == 10);
+  quiz_assert(store.calculationAtIndex(0)->heightIsKnown(false));
+  quiz_assert(!store.calculationAtIndex(0)->heightIsKnown(true));
+  quiz_assert(store.calculationAtIndex(0)->height(false, countingHeight) == 10);
+  quiz_assert(sNumberOfComputedHeights == 5);
+  quiz_assert(store.calculationAtIndex(1)->height(true, countingHeight) == 20);
+  quiz_assert(sNumberOfComputedHeights == 6);
+}
+
+QUIZ_CASE(calculation_history_layout_cache) {
+  HistoryLayoutCache cache;
+  bool found;
+  constexpr int numberOfEntries = 8;
+  for (uint32_t crc = 1; crc <= numberOfEntries; crc++) {
+    HistoryLayoutCache::Entry * entry = cache.entryForCalculation(crc, &found);
+    quiz_assert(!found);
+    entry->setLayouts(crc, CodePointLayout::Builder('0' + crc), Layout(), CodePointLayout::Builder('0' + crc), AdditionalInformationType::None);
+  }
+  HistoryLayoutCache::Entry * entry = cache.entryForCalculation(1, &found);
+  quiz_assert(found);
+  quiz_assert(entry->inputLayout().isIdenticalTo(CodePointLayout::Builder('1')));
+  quiz_assert(entry->exactOutputLayout().isUninitialized());
+
+  // The least recently used calculation 2 is replaced
+  entry = cache.entryForCalculation(numberOfEntries + 1, &found);
+  quiz_assert(!found);
+  entry->setLayouts(numberOfEntries + 1, CodePointLayout::Builder('9'), Layout(), Layout(), AdditionalInformationType::Integer);
+  quiz_assert(cache.entryForCalculation(numberOfEntries + 1, &found)->additionalInformationType() == AdditionalInformationType::Integer && found);
+  cache.entryForCalculation(1, &found);
+  quiz_assert(found);
+  cache.entryForCalculation(2, &found);
+  quiz_assert(!found);
+
+  cache.clear();
+  cache.entryForCalculation(1, &found);
+  quiz_assert(!found);
+}
+
 void assertAnsIs(const char * input, const char * expectedAnsInputText, Context * context, CalculationStore * store) {
   store->push(input, context, dummyHeight);
   store->push("Ans", context, dummyHeight);
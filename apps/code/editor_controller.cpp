@@ -35,8 +35,10 @@ void EditorController::setScript(Script script, int scriptIndex) {
    * |****|****|m_script|¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨¨|****|**********|
    *                          available space
    *
+   * The compiled scripts are dropped beforehand to make room for the edition.
    * */
 
+  ScriptStore::DeleteCompiledScripts();
   Ion::Storage::FileSystem::sharedFileSystem()->putAvailableSpaceAtEndOfRecord(m_script);
   m_editorView.setText(const_cast<char *>(m_script.content()), m_script.contentSize());
 }
@@ -137,6 +137,7 @@ void MenuController::renameSelectedScript() {
 
 void MenuController::deleteScript(Script script) {
   assert(!script.isNull());
+  ScriptStore::DeleteCompiledScript(script);
   script.destroy();
   updateAddScriptRowDisplay();
 }
@@ -317,6 +318,7 @@ bool MenuController::textFieldDidFinishEditing(TextField * textField, const char
     newName = const_cast<const char *>(numberedDefaultName);
   }
   Script script = m_scriptStore->scriptAtIndex(m_selectableTableView.selectedRow());
+  ScriptStore::DeleteCompiledScript(script);
   Script::ErrorStatus error = Script::NameCompliant(newName) ? Ion::Storage::Record::SetFullName(&script, newName) : Script::ErrorStatus::NonCompliantName;
   if (error == Script::ErrorStatus::None) {
     updateAddScriptRowDisplay();
@@ -19,6 +19,15 @@ void ScriptStore::deleteAllScripts() {
   for (int i = numberOfScripts() - 1; i >= 0; i--) {
     scriptAtIndex(i).destroy();
   }
+  DeleteCompiledScripts();
+}
+
+void ScriptStore::DeleteCompiledScript(Script script) {
+  CompiledScriptNamed(script.fullName()).destroy();
+}
+
+void ScriptStore::DeleteCompiledScripts() {
+  MicroPython::destroyCompiledScripts();
 }
 
 bool ScriptStore::isFull() {
@@ -36,6 +45,51 @@ const char * ScriptStore::contentOfScript(const char * name, bool markAsFetched)
   return script.content();
 }
 
+#if MICROPY_PORT_COMPILE_FILE
+
+const void * ScriptStore::compiledScript(const char * name, uint32_t key, size_t * size) {
+  Ion::Storage::Record record = CompiledScriptNamed(name);
+  if (record.isNull()) {
+    return nullptr;
+  }
+  Ion::Storage::Record::Data data = record.value();
+  if (data.size < sizeof(CompiledScriptHeader)) {
+    return nullptr;
+  }
+  CompiledScriptHeader header;
+  memcpy(&header, data.buffer, sizeof(header));
+  const uint8_t * bytecode = static_cast<const uint8_t *>(data.buffer) + sizeof(header);
+  size_t bytecodeSize = data.size - sizeof(header);
+  if (header.key != key || header.bytecodeCRC32 != Ion::crc32Byte(bytecode, bytecodeSize)) {
+    return nullptr;
+  }
+  *size = bytecodeSize;
+  return bytecode;
+}
+
+bool ScriptStore::storeCompiledScript(const char * name, uint32_t key, const void * data, size_t size) {
+  // Drop the stale compiled script
+  destroyCompiledScript(name);
+  Ion::Storage::Record::Name recordName = Ion::Storage::Record::CreateRecordNameFromFullName(name);
+  recordName.extension = MicroPython::compiledScriptExtension;
+  /* Do not fill the storage with compiled scripts: there should still be room
+   * for a new script afterwards. */
+  size_t recordSize = sizeof(Ion::Storage::FileSystem::record_size_t) + Ion::Storage::Record::SizeOfName(recordName) + sizeof(CompiledScriptHeader) + size;
+  if (Ion::Storage::FileSystem::sharedFileSystem()->availableSize() < recordSize + k_fullFreeSpaceSizeLimit) {
+    return false;
+  }
+  CompiledScriptHeader header = {key, Ion::crc32Byte(static_cast<const uint8_t *>(data), size)};
+  const void * dataChunks[] = {&header, data};
+  size_t sizeChunks[] = {sizeof(header), size};
+  return Ion::Storage::FileSystem::sharedFileSystem()->createRecordWithDataChunks(recordName, dataChunks, sizeChunks, 2) == Ion::Storage::Record::ErrorStatus::None;
+}
+
+void ScriptStore::destroyCompiledScript(const char * name) {
+  CompiledScriptNamed(name).destroy();
+}
+
+#endif
+
 void ScriptStore::clearVariableBoxFetchInformation() {
   // TODO optimize fetches
   const int scriptsCount = numberOfScripts();
@@ -52,4 +106,9 @@ void ScriptStore::clearConsoleFetchInformation() {
   }
 }
 
+Ion::Storage::Record ScriptStore::CompiledScriptNamed(const char * scriptName) {
+  Ion::Storage::Record::Name recordName = Ion::Storage::Record::CreateRecordNameFromFullName(scriptName);
+  return Ion::Storage::FileSystem::sharedFileSystem()->recordNamed({recordName.baseName, recordName.baseNameLength, MicroPython::compiledScriptExtension});
+}
+
 }
@@ -36,10 +36,20 @@ public:
     return addScriptFromTemplate(ScriptTemplate::Empty());
   }
   void deleteAllScripts();
+  /* Compiled scripts are only a cache of the imported scripts: they are
+   * dropped to give all the storage space to the editor, and the storage
+   * drops them when other records need room. */
+  static void DeleteCompiledScript(Script script);
+  static void DeleteCompiledScripts();
   bool isFull();
 
   /* MicroPython::ScriptProvider */
   const char * contentOfScript(const char * name, bool markAsFetched) override;
+#if MICROPY_PORT_COMPILE_FILE
+  const void * compiledScript(const char * name, uint32_t key, size_t * size) override;
+  bool storeCompiledScript(const char * name, uint32_t key, const void * data, size_t size) override;
+  void destroyCompiledScript(const char * name) override;
+#endif
   void clearVariableBoxFetchInformation();
   void clearConsoleFetchInformation();
 
@@ -53,6 +63,16 @@ private:
    * (20 char) and 10 char of free space. */
   static constexpr int k_fullFreeSpaceSizeLimit = sizeof(Ion::Storage::FileSystem::record_size_t)+Script::k_defaultScriptNameMaxSize+k_scriptExtensionLength+1+20+10;
 
+  /* Record: | Size |  Name |                Body                |
+   * Compiled script:     | Key | CRC32 |       Bytecode         |
+   * The CRC32 of the bytecode is checked before it is loaded, since the
+   * storage can be written from outside, through DFU. */
+  struct CompiledScriptHeader {
+    uint32_t key;
+    uint32_t bytecodeCRC32;
+  };
+  static Ion::Storage::Record CompiledScriptNamed(const char * scriptName);
+
   Ion::Storage::Record::ErrorStatus addScriptFromTemplate(const ScriptTemplate * scriptTemplate) {
     return Script::Create(scriptTemplate->name(), scriptTemplate->content());
   }
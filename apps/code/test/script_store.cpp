@@ -0,0 +1,128 @@
+#include <quiz.h>
+#include "../script_store.h"
+#include <python/test/execution_environment.h>
+#include <string.h>
+
+using namespace Code;
+
+#if MICROPY_PORT_COMPILE_FILE
+
+static void set_script_content(Script script, const char * content) {
+  constexpr int dataBufferSize = 200;
+  char dataBuffer[dataBufferSize];
+  dataBuffer[0] = 0; // Status
+  strlcpy(dataBuffer + 1, content, dataBufferSize - 1);
+  script.setValue({.buffer = dataBuffer, .size = strlen(content) + 2});
+}
+
+static void assert_module_returns(const char * command, const char * output, bool expectCompilation) {
+  Ion::Storage::FileSystem * fileSystem = Ion::Storage::FileSystem::sharedFileSystem();
+  uint32_t numberOfChanges = fileSystem->numberOfChanges();
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from module import *");
+  // The compiled script is only stored when the module is compiled
+  quiz_assert((fileSystem->numberOfChanges() != numberOfChanges) == expectCompilation);
+  quiz_assert(!fileSystem->recordBaseNamedWithExtension("module", MicroPython::compiledScriptExtension).isNull());
+  assert_command_execution_succeeds(env, command, output);
+  deinit_environment();
+}
+
+// As the apps container does, make room by destroying the compiled scripts
+class CompiledScriptsDestroyer : public Ion::Storage::StorageDelegate {
+public:
+  void storageDidChangeForRecord(const Ion::Storage::Record record) override {}
+  void storageIsFull() override {}
+  bool storageCanFreeSpace(const Ion::Storage::Record recordToKeep) override {
+    return MicroPython::destroyCompiledScripts(recordToKeep);
+  }
+};
+
+QUIZ_CASE(code_compiled_script_cache) {
+  ScriptStore store;
+  store.deleteAllScripts();
+  quiz_assert(Script::Create("module.py", "def f(x):\n  return 2*x\n") == Script::ErrorStatus::None);
+  Script script = ScriptStore::ScriptNamed("module.py");
+  MicroPython::registerScriptProvider(&store);
+
+  assert_module_returns("f(3)", "6\n", true);
+  assert_module_returns("f(3)", "6\n", false);
+
+  // Editing the script invalidates its compiled script
+  set_script_content(script, "def f(x):\n  return 3*x\n");
+  assert_module_returns("f(3)", "9\n", true);
+  assert_module_returns("f(4)", "12\n", false);
+
+  // An altered compiled script is not loaded
+  Ion::Storage::Record compiledScript = Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension("module", MicroPython::compiledScriptExtension);
+  constexpr int compiledScriptBufferSize = 200;
+  char compiledScriptBuffer[compiledScriptBufferSize];
+  Ion::Storage::Record::Data compiledScriptData = compiledScript.value();
+  quiz_assert(compiledScriptData.size <= compiledScriptBufferSize);
+  memcpy(compiledScriptBuffer, compiledScriptData.buffer, compiledScriptData.size);
+  compiledScriptBuffer[compiledScriptData.size - 1] ^= 1;
+  compiledScript.setValue({.buffer = compiledScriptBuffer, .size = compiledScriptData.size});
+  assert_module_returns("f(4)", "12\n", true);
+
+  // A compiled script that cannot be loaded is compiled again
+  compiledScript = Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension("module", MicroPython::compiledScriptExtension);
+  compiledScriptData = compiledScript.value();
+  quiz_assert(compiledScriptData.size <= compiledScriptBufferSize);
+  memcpy(compiledScriptBuffer, compiledScriptData.buffer, compiledScriptData.size);
+  // Break the .mpy header that follows the key and the CRC32 of the bytecode
+  constexpr size_t bytecodeOffset = 2 * sizeof(uint32_t);
+  compiledScriptBuffer[bytecodeOffset] ^= 1;
+  uint32_t bytecodeCRC32 = Ion::crc32Byte(reinterpret_cast<const uint8_t *>(compiledScriptBuffer + bytecodeOffset), compiledScriptData.size - bytecodeOffset);
+  memcpy(compiledScriptBuffer + sizeof(uint32_t), &bytecodeCRC32, sizeof(uint32_t));
+  compiledScript.setValue({.buffer = compiledScriptBuffer, .size = compiledScriptData.size});
+  assert_module_returns("f(4)", "12\n", true);
+  assert_module_returns("f(4)", "12\n", false);
+
+#if MICROPY_EMIT_X64
+  // Native code is stored too
+  set_script_content(script, "@micropython.viper\ndef f(x:int)->int:\n  return 5*x\n@micropython.native\ndef g(x):\n  return 5*x\n");
+  assert_module_returns("f(3)+g(1)", "20\n", true);
+  assert_module_returns("f(3)+g(1)", "20\n", false);
+#endif
+
+  // The compiled scripts are destroyed when other records need their space
+  Ion::Storage::FileSystem * fileSystem = Ion::Storage::FileSystem::sharedFileSystem();
+  CompiledScriptsDestroyer destroyer;
+  fileSystem->setDelegate(&destroyer);
+  quiz_assert(!fileSystem->recordBaseNamedWithExtension("module", MicroPython::compiledScriptExtension).isNull());
+  constexpr size_t fillerChunkSize = 256;
+  constexpr size_t maxNumberOfFillerChunks = Ion::Storage::FileSystem::k_storageSize / fillerChunkSize + 1;
+  static const char fillerChunk[fillerChunkSize] = {0};
+  const void * fillerChunks[maxNumberOfFillerChunks];
+  size_t fillerChunkSizes[maxNumberOfFillerChunks];
+  // The filler record is one byte larger than the available space
+  size_t fillerSize = fileSystem->availableSize() + 1 - sizeof(Ion::Storage::FileSystem::record_size_t) - sizeof("filler.exp");
+  size_t numberOfFillerChunks = 0;
+  for (size_t remainingSize = fillerSize; remainingSize > 0; remainingSize -= fillerChunkSizes[numberOfFillerChunks++]) {
+    fillerChunks[numberOfFillerChunks] = fillerChunk;
+    fillerChunkSizes[numberOfFillerChunks] = remainingSize < fillerChunkSize ? remainingSize : fillerChunkSize;
+  }
+  quiz_assert(fileSystem->createRecordWithFullNameAndDataChunks("filler.exp", fillerChunks, fillerChunkSizes, numberOfFillerChunks) == Ion::Storage::Record::ErrorStatus::None);
+  quiz_assert(fileSystem->recordBaseNamedWithExtension("module", MicroPython::compiledScriptExtension).isNull());
+  fileSystem->recordNamed("filler.exp").destroy();
+  fileSystem->setDelegate(nullptr);
+
+  // Modules with 28 char names are imported or reported missing as usual
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "try:\n  import a_module_with_a_28_char_name\nexcept ImportError:\n  print('missing')\n", "missing\n");
+  quiz_assert(Script::Create("a_module_with_a_28_char_name.py", "x = 28\n") == Script::ErrorStatus::None);
+  assert_command_execution_succeeds(env, "from a_module_with_a_28_char_name import *");
+  assert_command_execution_succeeds(env, "x", "28\n");
+  deinit_environment();
+  quiz_assert(!fileSystem->recordBaseNamedWithExtension("a_module_with_a_28_char_name", MicroPython::compiledScriptExtension).isNull());
+
+  // A stale compiled script is not imported instead of a wrong script
+  set_script_content(script, "def f(x):\n  return 3*\n");
+  env = init_environement();
+  assert_command_execution_fails(env, "from module import *");
+  deinit_environment();
+
+  MicroPython::registerScriptProvider(nullptr);
+  store.deleteAllScripts();
+}
+
+#endif
@@ -36,6 +36,35 @@ Ion::Storage::Record::ErrorStatus ContinuousFunctionStore::addEmptyModel() {
   return error;
 }
 
+ContinuousFunctionCache * ContinuousFunctionStore::cacheForFunction(ContinuousFunction * function) const {
+  constexpr int numberOfCaches = ContinuousFunctionCache::k_numberOfAvailableCaches;
+  int cacheIndex = -1;
+  for (int i = 0; i < numberOfCaches; i++) {
+    if (function->cache() == m_functionCaches + i) {
+      cacheIndex = i;
+      break;
+    }
+  }
+  if (cacheIndex < 0) {
+    for (int i = 0; i < numberOfCaches; i++) {
+      if (m_cachesLastPass[i] != m_cachingPass && (cacheIndex < 0 || m_cachesLastPass[i] < m_cachesLastPass[cacheIndex])) {
+        cacheIndex = i;
+      }
+    }
+    if (cacheIndex < 0) {
+      return nullptr;
+    }
+    // The previous owner must not read values computed for another function
+    for (int i = 0; i < k_maxNumberOfMemoizedModels; i++) {
+      if (m_functions[i].cache() == m_functionCaches + cacheIndex) {
+        m_functions[i].setCache(nullptr);
+      }
+    }
+  }
+  m_cachesLastPass[cacheIndex] = m_cachingPass;
+  return m_functionCaches + cacheIndex;
+}
+
 ExpressionModelHandle * ContinuousFunctionStore::setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record record) const {
   assert(cacheIndex >= 0 && cacheIndex < maxNumberOfMemoizedModels());
   m_functions[cacheIndex] = ContinuousFunction(record);
@@ -8,7 +8,11 @@ namespace Graph {
 
 class ContinuousFunctionStore : public Shared::FunctionStore {
 public:
-  ContinuousFunctionStore() : FunctionStore() {}
+  ContinuousFunctionStore() : FunctionStore(), m_cachingPass(1) {
+    for (int i = 0; i < Shared::ContinuousFunctionCache::k_numberOfAvailableCaches; i++) {
+      m_cachesLastPass[i] = 0;
+    }
+  }
   int numberOfActiveFunctionsInTable() const {
     return numberOfModelsSatisfyingTest(&isFunctionActiveInTable, nullptr);
   }
@@ -32,7 +36,14 @@ public:
   Shared::ExpiringPointer<Shared::ContinuousFunction> modelForRecord(Ion::Storage::Record record) const {
     return Shared::ExpiringPointer<Shared::ContinuousFunction>(static_cast<Shared::ContinuousFunction *>(privateModelForRecord(record)));
   }
-  Shared::ContinuousFunctionCache * cacheAtIndex(int i) const { return (i < Shared::ContinuousFunctionCache::k_numberOfAvailableCaches) ? m_functionCaches + i : nullptr; }
+  /* Caches are handed out to the functions being drawn, whatever their
+   * index: a function keeps its cache from one drawing pass to the next, and
+   * otherwise takes the least recently used one. Caches already handed out
+   * during the current pass are never taken back, so that drawing more
+   * functions than there are caches does not evict them in turn. */
+  void beginCachingPass() const { m_cachingPass++; }
+  // Return nullptr if all the caches are used by other functions in this pass
+  Shared::ContinuousFunctionCache * cacheForFunction(Shared::ContinuousFunction * function) const;
   Ion::Storage::Record::ErrorStatus addEmptyModel() override;
   int maxNumberOfModels() const override { return k_maxNumberOfModels; }
 
@@ -62,6 +73,8 @@ private:
 
   mutable Shared::ContinuousFunction m_functions[k_maxNumberOfMemoizedModels];
   mutable Shared::ContinuousFunctionCache m_functionCaches[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable uint32_t m_cachesLastPass[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable uint32_t m_cachingPass;
 
 };
 
@@ -38,6 +38,7 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
   }
 
   FunctionGraphView::drawRect(ctx, rect);
+  functionStore->beginCachingPass();
   int areaIndex = 0;
   for (int i = 0; i < activeFunctionsCount ; i++) {
     if (functionWasInterrupted(i)) {
@@ -70,7 +71,7 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
           continue;
         }
       }
-      ContinuousFunctionCache * cch = functionStore->cacheAtIndex(i);
+      ContinuousFunctionCache * cch = functionStore->cacheForFunction(f.operator->());
       float tmin = f->tMin();
       float tmax = f->tMax();
       Axis axis = f->hasVerticalLines() ? Axis::Vertical : Axis::Horizontal;
@@ -137,19 +138,28 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
               return Poincare::Coordinate2D<float>(-INFINITY, -INFINITY);
             };
         Shared::CurveView::EvaluateXYForFloatParameter xyAreaBound = nullptr;
+        /* The curves are evaluated through a Sampler, which prepares the batch
+         * evaluations once for both curves. */
+        Shared::Function::Sampler sampler(f.operator->(), context());
         // Evaluations for the first curve
         Shared::CurveView::EvaluateXYForDoubleParameter xyDoubleEvaluation =
             [](double t, void * model, void * context) {
-              ContinuousFunction * f = (ContinuousFunction *)model;
+              const Shared::Function * f = static_cast<Shared::Function::Sampler *>(model)->function();
               Poincare::Context * c = (Poincare::Context *)context;
               return f->evaluateXYAtParameter(t, c, 0);
             };
         Shared::CurveView::EvaluateXYForFloatParameter xyFloatEvaluation =
             [](float t, void * model, void * context) {
-              ContinuousFunction * f = (ContinuousFunction *)model;
+              const Shared::Function * f = static_cast<Shared::Function::Sampler *>(model)->function();
               Poincare::Context * c = (Poincare::Context *)context;
               return f->evaluateXYAtParameter(t, c, 0);
             };
+        Shared::CurveView::EvaluateXYForFloatParameters xyFloatBatchEvaluation =
+            [](const float * t, Poincare::Coordinate2D<float> * xy, int n, void * model, void * context) {
+              Shared::Function::Sampler * sampler = static_cast<Shared::Function::Sampler *>(model);
+              Poincare::Context * c = (Poincare::Context *)context;
+              sampler->evaluateXYAtParameters(t, xy, n, c, 0);
+            };
         if (area != ContinuousFunction::AreaType::None) {
           if (area == ContinuousFunction::AreaType::Outside) {
             // Either plot the area above the first curve, or everywhere.
@@ -167,7 +177,7 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
             assert(area == ContinuousFunction::AreaType::Inside);
             // Plot the area inside : Between first and second curve evaluation
             xyAreaBound = [](float t, void * model, void * context) {
-              ContinuousFunction * f = (ContinuousFunction *)model;
+              const Shared::Function * f = static_cast<Shared::Function::Sampler *>(model)->function();
               Poincare::Context * c = (Poincare::Context *)context;
               return f->evaluateXYAtParameter(t, c, 1);
             };
@@ -176,24 +186,30 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
         bool isIntegral = f->color() && area == ContinuousFunction::AreaType::None;
         // 2 - Draw the first curve
         drawCartesianCurve(ctx, rect, tCacheMin, tmax, xyFloatEvaluation,
-                           f.operator->(), context(), f->color(), true,
+                           &sampler, context(), f->color(), true,
                            record == m_selectedRecord, f->color(), m_highlightedStart,
                            m_highlightedEnd, xyDoubleEvaluation,
                            f->drawDottedCurve(), xyAreaBound,
-                           shouldColorAreaWhenNan, isIntegral ? -1 : 1 << areaIndex, tCacheStep, axis);
+                           shouldColorAreaWhenNan, isIntegral ? -1 : 1 << areaIndex, tCacheStep, axis,
+                           xyFloatBatchEvaluation);
         if (hasTwoCurves) {
           /* Evaluations for the second cartesian curve, which is lesser than
            * the first one */
           xyDoubleEvaluation = [](double t, void * model, void * context) {
-            ContinuousFunction * f = (ContinuousFunction *)model;
+            const Shared::Function * f = static_cast<Shared::Function::Sampler *>(model)->function();
             Poincare::Context * c = (Poincare::Context *)context;
             return f->evaluateXYAtParameter(t, c, 1);
           };
           xyFloatEvaluation = [](float t, void * model, void * context) {
-            ContinuousFunction * f = (ContinuousFunction *)model;
+            const Shared::Function * f = static_cast<Shared::Function::Sampler *>(model)->function();
             Poincare::Context * c = (Poincare::Context *)context;
             return f->evaluateXYAtParameter(t, c, 1);
           };
+          xyFloatBatchEvaluation = [](const float * t, Poincare::Coordinate2D<float> * xy, int n, void * model, void * context) {
+            Shared::Function::Sampler * sampler = static_cast<Shared::Function::Sampler *>(model);
+            Poincare::Context * c = (Poincare::Context *)context;
+            sampler->evaluateXYAtParameters(t, xy, n, c, 1);
+          };
           // Reset the area plot constraints
           xyAreaBound = nullptr;
           shouldColorAreaWhenNan = false;
@@ -203,11 +219,11 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
           }
           // 3 - Draw the second curve
           drawCartesianCurve(
-              ctx, rect, tCacheMin, tmax, xyFloatEvaluation, f.operator->(),
+              ctx, rect, tCacheMin, tmax, xyFloatEvaluation, &sampler,
               context(), f->color(), true, record == m_selectedRecord,
               f->color(), m_highlightedStart, m_highlightedEnd, xyDoubleEvaluation,
               f->drawDottedCurve(), xyAreaBound, shouldColorAreaWhenNan,
-              1 << areaIndex, tCacheStep, axis);
+              1 << areaIndex, tCacheStep, axis, xyFloatBatchEvaluation);
         }
         if (area != ContinuousFunction::AreaType::None) {
           // We can properly display the superposition of up to 4 areas
@@ -28,13 +28,32 @@ void assert_check_cartesian_cache_against_function(ContinuousFunction * function
     assert_float_equals(t, functionValues.x1());
     assert_float_equals(cacheValues.x2(), functionValues.x2());
   }
+  // Check batch evaluations, which cache hits and misses at once
+  constexpr int batchSize = CompiledExpression::k_maxBatchSize;
+  float ts[batchSize];
+  Coordinate2D<float> cacheBatchValues[batchSize];
+  Coordinate2D<float> functionBatchValues[batchSize];
+  for (int i = 0; i < batchSize; i++) {
+    ts[i] = tMin + i * cache->step();
+    if (i % 3 == 0) {
+      // Not a cached parameter
+      ts[i] += cache->step() / 3.f;
+    }
+  }
+  cache->valuesForParameters(function, context, ts, cacheBatchValues, batchSize, 0);
+  Shared::Function::Sampler(function, context).evaluateXYAtParameters(ts, functionBatchValues, batchSize, context);
+  for (int i = 0; i < batchSize; i++) {
+    assert_float_equals(ts[i], cacheBatchValues[i].x1());
+    assert_float_equals(cacheBatchValues[i].x2(), functionBatchValues[i].x2());
+    assert_float_equals(cacheBatchValues[i].x2(), function->evaluateXYAtParameter(ts[i], context).x2());
+  }
   /* We set back the cache, so that it will not be invalidated in
    * PrepareForCaching later. */
   function->setCache(cache);
 }
 
 void assert_cartesian_cache_stays_valid_while_panning(ContinuousFunction * function, Context * context, InteractiveCurveViewRange * range, CurveViewCursor * cursor, ContinuousFunctionStore * store, float step) {
-  ContinuousFunctionCache * cache = store->cacheAtIndex(0);
+  ContinuousFunctionCache * cache = store->cacheForFunction(function);
   assert(cache);
 
   float tMin, tStep;
@@ -51,7 +70,7 @@ void assert_cartesian_cache_stays_valid_while_panning(ContinuousFunction * funct
 }
 
 void assert_check_polar_cache_against_function(ContinuousFunction * function, Context * context, InteractiveCurveViewRange * range, ContinuousFunctionStore * store) {
-  ContinuousFunctionCache * cache = store->cacheAtIndex(0);
+  ContinuousFunctionCache * cache = store->cacheForFunction(function);
   assert(cache);
 
   float tMin = range->xMin();
@@ -126,6 +145,72 @@ QUIZ_CASE(graph_caching) {
   Preferences::sharedPreferences()->setAngleUnit(previousAngleUnit);
 }
 
+void prepare_function_for_caching(ContinuousFunctionStore * store, int i) {
+  ContinuousFunction * function = store->modelForRecord(store->recordAtIndex(i)).operator->();
+  float tStep, tCacheStep;
+  ContinuousFunctionCache::ComputeNonCartesianSteps(&tStep, &tCacheStep, function->tMax(), function->tMin());
+  ContinuousFunctionCache::PrepareForCaching(function, store->cacheForFunction(function), function->tMin(), tCacheStep);
+}
+
+ContinuousFunctionCache * cache_of_function(ContinuousFunctionStore * store, int i) {
+  return store->modelForRecord(store->recordAtIndex(i))->cache();
+}
+
+QUIZ_CASE(graph_caching_shared_between_functions) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore store;
+  constexpr int numberOfCaches = ContinuousFunctionCache::k_numberOfAvailableCaches;
+  constexpr int numberOfFunctions = numberOfCaches + 2;
+  const char * definitions[] = {"f(θ)=θ", "g(θ)=2θ", "h(θ)=3θ", "p(θ)=4θ", "q(θ)=5θ", "r(θ)=6θ"};
+  static_assert(sizeof(definitions) / sizeof(definitions[0]) == numberOfFunctions, "There should be a definition per function");
+  for (int i = 0; i < numberOfFunctions; i++) {
+    addFunction(definitions[i], Polar, &store, &globalContext);
+  }
+
+  // Functions beyond the number of caches are not cached
+  store.beginCachingPass();
+  for (int i = 0; i < numberOfFunctions; i++) {
+    prepare_function_for_caching(&store, i);
+  }
+  ContinuousFunctionCache * caches[numberOfCaches];
+  for (int i = 0; i < numberOfCaches; i++) {
+    caches[i] = cache_of_function(&store, i);
+    quiz_assert(caches[i] != nullptr);
+    for (int j = 0; j < i; j++) {
+      quiz_assert(caches[i] != caches[j]);
+    }
+  }
+  for (int i = numberOfCaches; i < numberOfFunctions; i++) {
+    quiz_assert(cache_of_function(&store, i) == nullptr);
+  }
+
+  // Functions keep their cache from one pass to the next
+  store.beginCachingPass();
+  for (int i = 0; i < numberOfFunctions; i++) {
+    prepare_function_for_caching(&store, i);
+  }
+  for (int i = 0; i < numberOfCaches; i++) {
+    quiz_assert(cache_of_function(&store, i) == caches[i]);
+  }
+
+  // Caches of functions that are no longer drawn are handed out again
+  store.beginCachingPass();
+  for (int i = 2; i < numberOfFunctions; i++) {
+    prepare_function_for_caching(&store, i);
+  }
+  quiz_assert(cache_of_function(&store, 0) == nullptr);
+  quiz_assert(cache_of_function(&store, 1) == nullptr);
+  for (int i = 2; i < numberOfCaches; i++) {
+    quiz_assert(cache_of_function(&store, i) == caches[i]);
+  }
+  for (int i = numberOfCaches; i < numberOfFunctions; i++) {
+    ContinuousFunctionCache * cache = cache_of_function(&store, i);
+    quiz_assert(cache == caches[0] || cache == caches[1]);
+  }
+
+  store.removeAll();
+}
+
 QUIZ_CASE(graph_caching_signaling_nan) {
   quiz_assert(ContinuousFunctionCache::IsSignalingNan(ContinuousFunctionCache::SignalingNan()));
   quiz_assert(!ContinuousFunctionCache::IsSignalingNan(NAN));
@@ -37,7 +37,9 @@ void Model::fit(Store * store, int series, double * modelCoefficients, Poincare:
 
 void Model::privateFit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
   initCoefficientsForFit(modelCoefficients, k_initialCoefficientValue, false, store, series);
-  fitLevenbergMarquardt(store, series, modelCoefficients, context);
+  if (!isLinearInCoefficients() || !fitLeastSquares(store, series, modelCoefficients)) {
+    fitLevenbergMarquardt(store, series, modelCoefficients, context);
+  }
   uniformizeCoefficientsFromFit(modelCoefficients);
 }
 
@@ -109,6 +111,49 @@ void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoeff
   }
 }
 
+bool Model::fitLeastSquares(Store * store, int series, double * modelCoefficients) {
+  /* The model is linear in its coefficients, so chi2 is a quadratic function
+   * of them. Its minimum solves the normal equations A*da = B, where A is the
+   * alpha matrix and does not depend on the coefficients. A single step from
+   * any coefficients reaches it, and the next steps only correct the rounding
+   * errors of an ill-conditioned A. Return false if A cannot be inverted. */
+  int n = numberOfCoefficients();
+  assert(n > 0 && n <= k_maxNumberOfCoefficients);
+  double inverseA[Model::k_maxNumberOfCoefficients * Model::k_maxNumberOfCoefficients];
+  for (int i = 0; i < n; i++) {
+    for (int j = i; j < n; j++) {
+      double alpha = alphaCoefficient(store, series, modelCoefficients, i, j);
+      inverseA[i*n+j] = alpha;
+      inverseA[j*n+i] = alpha;
+    }
+  }
+  if (Matrix::ArrayInverse(inverseA, n, n) < 0) {
+    return false;
+  }
+  double currentChi2 = chi2(store, series, modelCoefficients);
+  for (int step = 0; step < k_maxNumberOfLeastSquaresSteps; step++) {
+    double operandsB[Model::k_maxNumberOfCoefficients];
+    for (int j = 0; j < n; j++) {
+      operandsB[j] = betaCoefficient(store, series, modelCoefficients, j);
+    }
+    double modelCoefficientSteps[Model::k_maxNumberOfCoefficients];
+    Multiplication::computeOnArrays<double>(inverseA, operandsB, modelCoefficientSteps, n, n, 1);
+    double newModelCoefficients[Model::k_maxNumberOfCoefficients];
+    for (int i = 0; i < n; i++) {
+      newModelCoefficients[i] = modelCoefficients[i] + modelCoefficientSteps[i];
+    }
+    double newChi2 = chi2(store, series, newModelCoefficients);
+    if (!(newChi2 < currentChi2)) {
+      break;
+    }
+    for (int i = 0; i < n; i++) {
+      modelCoefficients[i] = newModelCoefficients[i];
+    }
+    currentChi2 = newChi2;
+  }
+  return true;
+}
+
 double Model::chi2(Store * store, int series, double * modelCoefficients) const {
   double result = 0.0;
   for (int i = 0; i < store->numberOfPairsOfSeries(series); i++) {
@@ -50,6 +50,12 @@ private:
   // Model attributes
   virtual Poincare::Expression expression(double * modelCoefficients) { return Poincare::Expression(); } // expression is overridden only by Models that do not override levelSet
   virtual double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const = 0;
+  // Models linear in their coefficients have partial derivates independent of the coefficients
+  virtual bool isLinearInCoefficients() const { return false; }
+
+  // Linear least squares
+  static constexpr int k_maxNumberOfLeastSquaresSteps = 3;
+  bool fitLeastSquares(Store * store, int series, double * modelCoefficients);
 
   // Levenberg-Marquardt
   static constexpr double k_maxIterations = 300;
@@ -16,6 +16,8 @@ public:
   double levelSet(double * modelCoefficients, double xMin, double xMax, double y, Poincare::Context * context) override;
   double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const override;
   int numberOfCoefficients() const override { return 1; }
+private:
+  bool isLinearInCoefficients() const override { return true; }
 };
 
 }
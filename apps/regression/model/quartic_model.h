@@ -17,6 +17,7 @@ public:
   int numberOfCoefficients() const override { return 5; }
 private:
   Poincare::Expression expression(double * modelCoefficients) override;
+  bool isLinearInCoefficients() const override { return true; }
 };
 
 }
@@ -1,4 +1,5 @@
 #include <quiz.h>
+#include <quiz/stopwatch.h>
 #include <string.h>
 #include <assert.h>
 #include <apps/shared/global_context.h>
@@ -8,6 +9,7 @@
 #include <poincare/helpers.h>
 #include <poincare/trigonometry.h>
 #include <poincare/test/helper.h>
+#include <ion/timing.h>
 
 using namespace Poincare;
 using namespace Regression;
@@ -141,6 +143,64 @@ QUIZ_CASE(quartic_regression) {
   assert_regression_is(x, y, 10, Model::Type::Quartic, coefficients, r2);
 }
 
+QUIZ_CASE(polynomial_regression_least_squares) {
+  /* Models linear in their coefficients are fitted by least squares. Fitting
+   * the quartic dataset with each of them must give the coefficients
+   * Levenberg-Marquardt converged to, including for the models of lower
+   * degree that cannot fit it exactly. */
+  double x[] = {1.6, 3.5, 3.5, -2.8, 6.4, 5.3, 2.9, -4.8, -5.7, 3.1};
+  double y[] = {-112.667, -1479.824, -1479.805, 1140.276, -9365.505, -5308.355, -816.925, 5554.007, 9277.107, -1009.874};
+  Model::Type types[] = {Model::Type::Proportional, Model::Type::Quadratic, Model::Type::Cubic, Model::Type::Quartic};
+  double levenbergMarquardtCoefficients[][Model::k_maxNumberOfCoefficients] = {
+    {-1052.6405092957734},
+    {-53.124392278926287, -1132.0869233290798, 2054.5144632787451},
+    {-42.271480404795298, 45.591373748039238, -10.652090562675298, -152.41116481002098},
+    {0.59998011140137308, -42.999791471028253, 21.501483120448359, 3.0923227802990616, -0.4568238030336576},
+  };
+  int series = 0;
+  Shared::GlobalContext globalContext;
+  Model::Type regressionTypes[] = { Model::Type::None, Model::Type::None, Model::Type::None };
+  Regression::Store store(&globalContext, regressionTypes);
+  setRegressionPoints(&store, series, 10, x, y);
+  Shared::StoreContext context(&store, &globalContext);
+  for (size_t t = 0; t < sizeof(types)/sizeof(Model::Type); t++) {
+    store.setSeriesRegressionType(series, types[t]);
+    Model * model = store.modelForSeries(series);
+    double coefficients[Model::k_maxNumberOfCoefficients];
+    model->fit(&store, series, coefficients, &context);
+    for (int i = 0; i < model->numberOfCoefficients(); i++) {
+      quiz_assert(roughly_equal(coefficients[i], levenbergMarquardtCoefficients[t][i], 1e-6, false, 1e-9));
+    }
+  }
+}
+
+QUIZ_CASE(polynomial_regression_fit_speed) {
+  /* Fit the quartic dataset again, as each edition of the data does. The
+   * budget leaves room for slower targets than the few milliseconds the
+   * fits take on the simulator. */
+  double x[] = {1.6, 3.5, 3.5, -2.8, 6.4, 5.3, 2.9, -4.8, -5.7, 3.1};
+  double y[] = {-112.667, -1479.824, -1479.805, 1140.276, -9365.505, -5308.355, -816.925, 5554.007, 9277.107, -1009.874};
+  int series = 0;
+  Shared::GlobalContext globalContext;
+  Model::Type regressionTypes[] = { Model::Type::None, Model::Type::None, Model::Type::None };
+  Regression::Store store(&globalContext, regressionTypes);
+  setRegressionPoints(&store, series, 10, x, y);
+  Shared::StoreContext context(&store, &globalContext);
+  constexpr int k_numberOfFits = 100;
+  constexpr uint64_t k_maxDurationInMilliseconds = 1000;
+  Model::Type types[] = {Model::Type::Proportional, Model::Type::Quadratic, Model::Type::Cubic, Model::Type::Quartic};
+  uint64_t startTime = quiz_stopwatch_start();
+  for (Model::Type type : types) {
+    store.setSeriesRegressionType(series, type);
+    Model * model = store.modelForSeries(series);
+    double coefficients[Model::k_maxNumberOfCoefficients];
+    for (int i = 0; i < k_numberOfFits; i++) {
+      model->fit(&store, series, coefficients, &context);
+    }
+  }
+  quiz_assert(Ion::Timing::millis() - startTime < k_maxDurationInMilliseconds);
+}
+
 QUIZ_CASE(logarithmic_regression) {
   double x[] = {0.2, 0.5, 5, 7};
   double y[] = {-11.952, -9.035, -1.695, -0.584};
@@ -538,6 +538,39 @@ QUIZ_CASE(sequence_order) {
   store->tidyDownstreamPoolFrom();
 }
 
+QUIZ_CASE(sequence_rank_checkpoints) {
+  Shared::GlobalContext globalContext;
+  SequenceStore * store = globalContext.sequenceStore();
+  SequenceContext sequenceContext(&globalContext, store);
+  Sequence * u = addSequence(store, Sequence::Type::SingleRecurrence, "u(n)+n", "0", nullptr, &sequenceContext);
+  Sequence * v = addSequence(store, Sequence::Type::DoubleRecurrence, "0.5×v(n+1)-v(n)+1/(u(n+1)+1)", "1", "2", &sequenceContext);
+
+  // Jumping backwards and forwards gives the same values as iterating from 0
+  const double ranks[] = {1000., 260., 520., 9999., 3., 600., 250., 9750.};
+  for (double n : ranks) {
+    double un = u->evaluateXYAtParameter(n, &sequenceContext).x2();
+    double vn = v->evaluateXYAtParameter(n, &sequenceContext).x2();
+    float vnFloat = v->evaluateXYAtParameter(static_cast<float>(n), &sequenceContext).x2();
+    quiz_assert(un == n * (n - 1.) / 2.);
+    sequenceContext.resetCache();
+    quiz_assert(vn == v->evaluateXYAtParameter(n, &sequenceContext).x2());
+    sequenceContext.resetCache();
+    quiz_assert(vnFloat == v->evaluateXYAtParameter(static_cast<float>(n), &sequenceContext).x2());
+  }
+
+  // Another context takes the checkpoints over without altering the values
+  double v260 = v->evaluateXYAtParameter(260., &sequenceContext).x2();
+  v->evaluateXYAtParameter(1000., &sequenceContext);
+  {
+    SequenceContext otherSequenceContext(&globalContext, store);
+    quiz_assert(v->evaluateXYAtParameter(520., &otherSequenceContext).x2() == v->evaluateXYAtParameter(520., &sequenceContext).x2());
+  }
+  quiz_assert(v->evaluateXYAtParameter(260., &sequenceContext).x2() == v260);
+
+  store->removeAll();
+  store->tidyDownstreamPoolFrom();
+}
+
 QUIZ_CASE(sequence_sum_evaluation) {
   check_sum_of_sequence_between_bounds(33.0, 3.0, 8.0, Sequence::Type::Explicit, "n", nullptr, nullptr);
   check_sum_of_sequence_between_bounds(70.0, 2.0, 8.0, Sequence::Type::SingleRecurrence, "u(n)+2", "0", nullptr);
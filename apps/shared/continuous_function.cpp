@@ -433,15 +433,16 @@ void ContinuousFunction::yRangeForDisplay(float xMin, float xMax, float yMinForc
   }
 
   Zoom::ValueAtAbscissa evaluation = [](float x, Context * context, const void * auxiliary) {
-    return static_cast<const ContinuousFunction *>(auxiliary)->evaluateXYAtParameter(x, context, 0).x2();
+    return static_cast<const Sampler *>(auxiliary)->function()->evaluateXYAtParameter(x, context, 0).x2();
   };
+  Sampler sampler(this, context);
 
   /* TODO Hugo : yRangeForDisplay currently doesn't support ContinuousFunctions
    * with multiple curves. For that, RangeWithRatioForDisplay should be changed
    * to handle a second evaluation. In the meantime, all ContinuousFunctions
    * having two curves are displayed orthonormal. */
   if (yMaxForced - yMinForced <= ratio * (xMax - xMin) && numberOfSubCurves() == 1) {
-    Zoom::RangeWithRatioForDisplay(evaluation, ratio, xMin, xMax, yMinForced, yMaxForced, yMin, yMax, context, this);
+    Zoom::RangeWithRatioForDisplay(evaluation, ratio, xMin, xMax, yMinForced, yMaxForced, yMin, yMax, context, &sampler, Sampler::Ordinates);
     // if (numberOfSubCurves() >= 2) {
     //   assert(numberOfSubCurves() == 2);
     //   float yMinTemp = *yMin;
@@ -462,7 +463,7 @@ void ContinuousFunction::yRangeForDisplay(float xMin, float xMax, float yMinForc
     *yMax = NAN;
   }
 
-  Zoom::RefinedYRangeForDisplay(evaluation, xMin, xMax, yMin, yMax, context, this);
+  Zoom::RefinedYRangeForDisplay(evaluation, xMin, xMax, yMin, yMax, context, &sampler, Sampler::Ordinates);
 
   if (numberOfSubCurves() >= 2) {
     assert(numberOfSubCurves() == 2);
@@ -472,9 +473,16 @@ void ContinuousFunction::yRangeForDisplay(float xMin, float xMax, float yMinForc
     *yMax = NAN;
 
     Zoom::ValueAtAbscissa secondCurveEvaluation = [](float x, Context * context, const void * auxiliary) {
-      return static_cast<const ContinuousFunction *>(auxiliary)->evaluateXYAtParameter(x, context, 1).x2();
+      return static_cast<const Sampler *>(auxiliary)->function()->evaluateXYAtParameter(x, context, 1).x2();
     };
-    Zoom::RefinedYRangeForDisplay(secondCurveEvaluation, xMin, xMax, yMin, yMax, context, this);
+    Zoom::ValuesAtAbscissas secondCurveBatchEvaluation = [](const float * x, float * y, int n, Context * context, const void * auxiliary) {
+      Coordinate2D<float> xy[Zoom::k_evaluationBatchSize];
+      static_cast<const Sampler *>(auxiliary)->evaluateXYAtParameters(x, xy, n, context, 1);
+      for (int i = 0; i < n; i++) {
+        y[i] = xy[i].x2();
+      }
+    };
+    Zoom::RefinedYRangeForDisplay(secondCurveEvaluation, xMin, xMax, yMin, yMax, context, &sampler, secondCurveBatchEvaluation);
 
     Zoom::CombineRanges(yMinTemp, yMaxTemp, *yMin, *yMax, yMin, yMax);
   }
@@ -530,9 +538,77 @@ Coordinate2D<double> ContinuousFunction::nextPointOfInterestFrom(double start, d
   return compute(expressionReduced(context), k_unknownName, start, max, context, relativePrecision, minimalStep, maximalStep);
 }
 
+void ContinuousFunction::evaluateXYAtParameters(const float * t, Coordinate2D<float> * xy, int n, Context * context, int curveIndex, const CompiledExpression * compiledExpressions) const {
+  for (int i = 0; i < n; i += CompiledExpression::k_maxBatchSize) {
+    int batchSize = std::min(n - i, CompiledExpression::k_maxBatchSize);
+    if (m_cache) {
+      m_cache->valuesForParameters(this, context, t + i, xy + i, batchSize, curveIndex);
+    } else {
+      privateEvaluateXYAtParameters(t + i, xy + i, batchSize, context, curveIndex, compiledExpressions);
+    }
+  }
+}
+
+void ContinuousFunction::compileForSampling(CompiledExpression * compiledExpressions, Context * context) const {
+  static_assert(Sampler::k_maxNumberOfCompiledExpressions >= k_maxNumberOfComponents, "A Sampler should hold a compiled expression per component");
+  // The cache evaluates the missing values with its own compiled expressions
+  if (!m_cache) {
+    compileComponents(compiledExpressions, context);
+  }
+}
+
+template <typename T>
+Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t, Context * context, int subCurveIndex, const CompiledExpression * compiledExpressions) const {
+  return xyFromCoordinates(templatedApproximateAtParameter(t, context, subCurveIndex, compiledExpressions));
+}
+
 template <typename T>
-Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t, Context * context, int subCurveIndex) const {
-  Coordinate2D<T> x1x2 = templatedApproximateAtParameter(t, context, subCurveIndex);
+void ContinuousFunction::privateEvaluateXYAtParameters(const T * t, Coordinate2D<T> * xy, int n, Context * context, int subCurveIndex, const CompiledExpression * compiledExpressions) const {
+  assert(n <= CompiledExpression::k_maxBatchSize);
+  T firstComponent[CompiledExpression::k_maxBatchSize];
+  T secondComponent[CompiledExpression::k_maxBatchSize];
+  bool isParametric = plotType() == PlotType::Parametric;
+  approximateComponentAtParameters(t, firstComponent, n, context, isParametric ? 0 : subCurveIndex, compiledExpressions);
+  if (isParametric) {
+    approximateComponentAtParameters(t, secondComponent, n, context, 1, compiledExpressions);
+  }
+  for (int i = 0; i < n; i++) {
+    xy[i] = xyFromCoordinates(coordinatesFromComponents(t[i], firstComponent[i], isParametric ? secondComponent[i] : NAN));
+  }
+}
+
+template<typename T>
+Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Context * context, int subCurveIndex, const CompiledExpression * compiledExpressions) const {
+  if (t < tMin() || t > tMax()) {
+    return coordinatesFromComponents<T>(t, NAN, NAN);
+  }
+  if (plotType() != PlotType::Parametric) {
+    return coordinatesFromComponents<T>(t, approximateComponentAtParameter(t, context, subCurveIndex, compiledExpressions), NAN);
+  }
+  return coordinatesFromComponents(
+      t,
+      approximateComponentAtParameter(t, context, 0, compiledExpressions),
+      approximateComponentAtParameter(t, context, 1, compiledExpressions));
+}
+
+template<typename T>
+Coordinate2D<T> ContinuousFunction::coordinatesFromComponents(T t, T firstComponent, T secondComponent) const {
+  if (t < tMin() || t > tMax()) {
+    return Coordinate2D<T>(isAlongX() ? t : NAN, NAN);
+  }
+  PlotType type = plotType();
+  if (type == PlotType::Parametric) {
+    return Coordinate2D<T>(firstComponent, secondComponent);
+  }
+  if (type == PlotType::VerticalLine || type == PlotType::VerticalLines) {
+    // Invert x and y with vertical lines so it can be scrolled vertically
+    return Coordinate2D<T>(firstComponent, t);
+  }
+  return Coordinate2D<T>(t, firstComponent);
+}
+
+template<typename T>
+Coordinate2D<T> ContinuousFunction::xyFromCoordinates(Coordinate2D<T> x1x2) const {
   if (plotType() != PlotType::Polar) {
     return x1x2;
   }
@@ -541,39 +617,79 @@ Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t, Context *
                          x1x2.x2() * std::sin(angle));
 }
 
-template<typename T>
-Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Context * context, int subCurveIndex) const {
-  if (t < tMin() || t > tMax()) {
-    return Coordinate2D<T>(isAlongX() ? t : NAN, NAN);
-  }
+Expression ContinuousFunction::componentExpression(Context * context, int componentIndex) const {
+  assert(0 <= componentIndex && componentIndex < k_maxNumberOfComponents);
   Expression e = expressionReduced(context);
-  PlotType type = plotType();
-  if (type != PlotType::Parametric) {
+  if (plotType() != PlotType::Parametric) {
     if (numberOfSubCurves() >= 2) {
-      assert(e.numberOfChildren() > subCurveIndex);
-      e = e.childAtIndex(subCurveIndex);
-    } else {
-      assert(subCurveIndex == 0);
-    }
-    if (type == PlotType::VerticalLine || type == PlotType::VerticalLines) {
-      // Invert x and y with vertical lines so it can be scrolled vertically
-      return Coordinate2D<T>(PoincareHelpers::ApproximateWithValueForSymbol(e, k_unknownName, t, context), t);
+      assert(e.numberOfChildren() > componentIndex);
+      return e.childAtIndex(componentIndex);
     }
-    return Coordinate2D<T>(t, PoincareHelpers::ApproximateWithValueForSymbol(e, k_unknownName, t, context));
+    assert(componentIndex == 0);
+    return e;
   }
   if (e.type() == ExpressionNode::Type::Dependency) {
     e = e.childAtIndex(0);
   }
   if (e.isUndefined()) {
-    return Coordinate2D<T>(NAN, NAN);
+    return e;
   }
   // TODO : This should maybe be a List instead of a Matrix
   assert(e.type() == ExpressionNode::Type::Matrix);
   assert(static_cast<Matrix&>(e).numberOfRows() == 2);
   assert(static_cast<Matrix&>(e).numberOfColumns() == 1);
-  return Coordinate2D<T>(
-      PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(0), k_unknownName, t, context),
-      PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(1), k_unknownName, t, context));
+  return e.childAtIndex(componentIndex);
+}
+
+template<typename T>
+T ContinuousFunction::approximateComponentAtParameter(T t, Context * context, int componentIndex, const CompiledExpression * compiledExpressions) const {
+  T result;
+  if (compiledExpressions
+   && compiledExpressions[componentIndex].isCompiled()
+   && compiledExpressions[componentIndex].approximateWithValueForSymbol(t, &result)) {
+    return result;
+  }
+  return PoincareHelpers::ApproximateWithValueForSymbol(componentExpression(context, componentIndex), k_unknownName, t, context);
+}
+
+template<typename T>
+void ContinuousFunction::approximateComponentAtParameters(const T * t, T * results, int n, Context * context, int componentIndex, const CompiledExpression * compiledExpressions) const {
+  assert(n <= CompiledExpression::k_maxBatchSize);
+  bool handled[CompiledExpression::k_maxBatchSize];
+  bool isCompiled = compiledExpressions && compiledExpressions[componentIndex].isCompiled();
+  if (isCompiled) {
+    compiledExpressions[componentIndex].approximateWithValuesForSymbol(t, results, handled, n);
+  }
+  Expression e;
+  for (int i = 0; i < n; i++) {
+    if (isCompiled && handled[i]) {
+      continue;
+    }
+    if (e.isUninitialized()) {
+      e = componentExpression(context, componentIndex);
+    }
+    results[i] = PoincareHelpers::ApproximateWithValueForSymbol(e, k_unknownName, t[i], context);
+  }
+}
+
+void ContinuousFunction::compileComponents(CompiledExpression * compiledExpressions, Context * context) const {
+  // Calling expressionReduced first so that numberOfSubCurves is up to date
+  expressionReduced(context);
+  int numberOfComponents = plotType() == PlotType::Parametric ? 2 : numberOfSubCurves();
+  for (int i = 0; i < k_maxNumberOfComponents; i++) {
+    if (i >= numberOfComponents) {
+      compiledExpressions[i].clear();
+      continue;
+    }
+    Expression e = componentExpression(context, i);
+    Preferences * preferences = Preferences::sharedPreferences();
+    compiledExpressions[i].compile(e, k_unknownName, context, Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context), preferences->angleUnit());
+  }
+}
+
+Ion::Storage::Record::Data ContinuousFunction::equationData() const {
+  Ion::Storage::Record::Data data = value();
+  return {.buffer = static_cast<const char *>(data.buffer) + metaDataSize(), .size = data.size - metaDataSize()};
 }
 
 /* ContinuousFunction::Model */
@@ -1084,11 +1200,13 @@ size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * re
 }
 
 
-template Coordinate2D<float> ContinuousFunction::templatedApproximateAtParameter<float>(float, Context *, int) const;
-template Coordinate2D<double> ContinuousFunction::templatedApproximateAtParameter<double>(double, Context *, int) const;
+template Coordinate2D<float> ContinuousFunction::templatedApproximateAtParameter<float>(float, Context *, int, const CompiledExpression *) const;
+template Coordinate2D<double> ContinuousFunction::templatedApproximateAtParameter<double>(double, Context *, int, const CompiledExpression *) const;
+
+template Coordinate2D<float> ContinuousFunction::privateEvaluateXYAtParameter<float>(float, Context *, int, const CompiledExpression *) const;
+template Coordinate2D<double> ContinuousFunction::privateEvaluateXYAtParameter<double>(double, Context *, int, const CompiledExpression *) const;
 
-template Coordinate2D<float> ContinuousFunction::privateEvaluateXYAtParameter<float>(float, Context *, int) const;
-template Coordinate2D<double> ContinuousFunction::privateEvaluateXYAtParameter<double>(double, Context *, int) const;
+template void ContinuousFunction::privateEvaluateXYAtParameters<float>(const float *, Coordinate2D<float> *, int, Context *, int, const CompiledExpression *) const;
 
 
 } // namespace Graph
@@ -13,6 +13,7 @@
 #include "range_1D.h"
 #include <apps/i18n.h>
 #include <poincare/symbol_abstract.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/conic.h>
 #include <poincare/preferences.h>
 #include "continuous_function_cache.h"
@@ -162,6 +163,9 @@ public:
   Poincare::Expression originalEquation(const Ion::Storage::Record * record) const {
     return m_model.originalEquation(record, symbol());
   }
+  /* Return where the equation is in the storage, expressionClone being its
+   * right side. It is valid until the storage changes. */
+  Ion::Storage::Record::Data equationData() const;
   // Update plotType as well as tMin and tMax values.
   void udpateModel(Poincare::Context * context);
 
@@ -176,6 +180,7 @@ public:
   Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context, int curveIndex = 0) const override {
     return privateEvaluateXYAtParameter<double>(t, context, curveIndex);
   }
+  void evaluateXYAtParameters(const float * t, Poincare::Coordinate2D<float> * xy, int n, Poincare::Context * context, int curveIndex, const Poincare::CompiledExpression * compiledExpressions) const override;
 
   /* Derivative */
 
@@ -236,6 +241,8 @@ public:
   static constexpr CodePoint k_cartesianSymbol = 'x';
   static constexpr CodePoint k_parametricSymbol = 't';
   static constexpr CodePoint k_polarSymbol = UCodePointGreekSmallLetterTheta;
+  // Sub curves or parametric coordinates
+  static constexpr int k_maxNumberOfComponents = 2;
 private:
   static constexpr char k_unknownName[2] = {UCodePointUnknown, 0};
   static constexpr char k_ordinateName[2] = "y";
@@ -255,6 +262,10 @@ private:
   // Return step computed from t range or NAN if isAlongX() is true.
   float rangeStep() const override;
 
+  /* Evaluation */
+
+  void compileForSampling(Poincare::CompiledExpression * compiledExpressions, Poincare::Context * context) const override;
+
   /* Expressions */
 
   // Return the expression representing the equation for computations
@@ -269,10 +280,25 @@ private:
   typedef Poincare::Coordinate2D<double> (*ComputePointOfInterest)(Poincare::Expression e, const char * symbol, double start, double max, Poincare::Context * context, double relativePrecision, double minimalStep, double maximalStep);
   // Compute coordinates of the next point of interest, from a starting point
   Poincare::Coordinate2D<double> nextPointOfInterestFrom(double start, double max, Poincare::Context * context, ComputePointOfInterest compute, double relativePrecision, double minimalStep, double maximalStep) const;
-  // Evaluate XY at parameter (distinct from approximation with Polar types)
-  template<typename T> Poincare::Coordinate2D<T> privateEvaluateXYAtParameter(T t, Poincare::Context * context, int subCurveIndex = 0) const;
+  /* Evaluate XY at parameter (distinct from approximation with Polar types).
+   * If provided, compiledExpressions are used instead of the reduced
+   * expression whenever they can handle t. */
+  template<typename T> Poincare::Coordinate2D<T> privateEvaluateXYAtParameter(T t, Poincare::Context * context, int subCurveIndex = 0, const Poincare::CompiledExpression * compiledExpressions = nullptr) const;
+  // Evaluate XY at n <= CompiledExpression::k_maxBatchSize parameters at once
+  template<typename T> void privateEvaluateXYAtParameters(const T * t, Poincare::Coordinate2D<T> * xy, int n, Poincare::Context * context, int subCurveIndex, const Poincare::CompiledExpression * compiledExpressions) const;
   // Approximate XY at parameter
-  template<typename T> Poincare::Coordinate2D<T> templatedApproximateAtParameter(T t, Poincare::Context * context, int subCurveIndex = 0) const;
+  template<typename T> Poincare::Coordinate2D<T> templatedApproximateAtParameter(T t, Poincare::Context * context, int subCurveIndex = 0, const Poincare::CompiledExpression * compiledExpressions = nullptr) const;
+  // Arrange the approximated components according to the plot type
+  template<typename T> Poincare::Coordinate2D<T> coordinatesFromComponents(T t, T firstComponent, T secondComponent) const;
+  // Convert polar coordinates to XY
+  template<typename T> Poincare::Coordinate2D<T> xyFromCoordinates(Poincare::Coordinate2D<T> x1x2) const;
+  /* Return the expression of a sub curve, or of a coordinate for parametric
+   * functions. */
+  Poincare::Expression componentExpression(Poincare::Context * context, int componentIndex) const;
+  template<typename T> T approximateComponentAtParameter(T t, Poincare::Context * context, int componentIndex, const Poincare::CompiledExpression * compiledExpressions) const;
+  template<typename T> void approximateComponentAtParameters(const T * t, T * results, int n, Poincare::Context * context, int componentIndex, const Poincare::CompiledExpression * compiledExpressions) const;
+  // Fill compiledExpressions with the compiled form of each component
+  void compileComponents(Poincare::CompiledExpression * compiledExpressions, Poincare::Context * context) const;
 
   /* Record */
 
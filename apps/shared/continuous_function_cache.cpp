@@ -7,15 +7,16 @@ namespace Shared {
 constexpr int ContinuousFunctionCache::k_sizeOfCache;
 constexpr float ContinuousFunctionCache::k_cacheHitTolerance;
 constexpr int ContinuousFunctionCache::k_numberOfAvailableCaches;
+constexpr int ContinuousFunctionCache::k_numberOfCompiledExpressions;
 
 // public
 void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCache * cache, float tMin, float tStep) {
   ContinuousFunction * function = static_cast<ContinuousFunction *>(fun);
 
   if (!cache) {
-    /* ContinuousFunctionStore::cacheAtIndex has returned a nullptr : the index
-     * of the function we are trying to draw is greater than the number of
-     * available caches, so we just tell the function to not lookup any cache. */
+    /* ContinuousFunctionStore::cacheForFunction has returned a nullptr : all
+     * the available caches are used by the other functions being drawn, so we
+     * just tell the function to not lookup any cache. */
     function->setCache(nullptr);
     return;
   }
@@ -49,19 +50,56 @@ void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCa
 }
 
 void ContinuousFunctionCache::clear() {
+  m_expressionsAreCompiled = false;
   m_startOfCache = 0;
   m_tStep = 0;
   invalidateBetween(0, k_sizeOfCache);
 }
 
 Poincare::Coordinate2D<float> ContinuousFunctionCache::valueForParameter(const ContinuousFunction * function, Poincare::Context * context, float t, int curveIndex) {
+  compileExpressionsIfNeeded(function, context);
   int resIndex = indexForParameter(function, t, curveIndex);
   if (resIndex < 0) {
-    return function->privateEvaluateXYAtParameter(t, context, curveIndex);
+    return function->privateEvaluateXYAtParameter(t, context, curveIndex, m_compiledExpressions);
   }
   return valuesAtIndex(function, context, t, resIndex, curveIndex);
 }
 
+void ContinuousFunctionCache::valuesForParameters(const ContinuousFunction * function, Poincare::Context * context, const float * t, Poincare::Coordinate2D<float> * xy, int n, int curveIndex) {
+  constexpr int k_maxBatchSize = Poincare::CompiledExpression::k_maxBatchSize;
+  assert(n <= k_maxBatchSize);
+  compileExpressionsIfNeeded(function, context);
+  float missingT[k_maxBatchSize];
+  int missingIndexes[k_maxBatchSize];
+  int missingCacheIndexes[k_maxBatchSize];
+  int numberOfMissingValues = 0;
+  for (int i = 0; i < n; i++) {
+    int resIndex = indexForParameter(function, t[i], curveIndex);
+    if (resIndex >= 0 && hasValuesAtIndex(function, resIndex)) {
+      xy[i] = cachedValuesAtIndex(function, t[i], resIndex);
+      continue;
+    }
+    missingT[numberOfMissingValues] = t[i];
+    missingIndexes[numberOfMissingValues] = i;
+    missingCacheIndexes[numberOfMissingValues] = resIndex;
+    numberOfMissingValues++;
+  }
+  if (numberOfMissingValues == 0) {
+    return;
+  }
+  Poincare::Coordinate2D<float> missingXY[k_maxBatchSize];
+  function->privateEvaluateXYAtParameters(missingT, missingXY, numberOfMissingValues, context, curveIndex, m_compiledExpressions);
+  for (int j = 0; j < numberOfMissingValues; j++) {
+    int i = missingIndexes[j];
+    if (missingCacheIndexes[j] < 0) {
+      xy[i] = missingXY[j];
+      continue;
+    }
+    storeValuesAtIndex(function, missingXY[j], missingCacheIndexes[j]);
+    xy[i] = cachedValuesAtIndex(function, t[i], missingCacheIndexes[j]);
+  }
+}
+
 void ContinuousFunctionCache::ComputeNonCartesianSteps(float * tStep, float * tCacheStep, float tMax, float tMin) {
   // Expected step length
   *tStep = (tMax - tMin) / Graph::GraphView::k_graphStepDenominator;
@@ -117,22 +155,46 @@ int ContinuousFunctionCache::indexForParameter(const ContinuousFunction * functi
   return (res + m_startOfCache) % k_sizeOfCache;
 }
 
+void ContinuousFunctionCache::compileExpressionsIfNeeded(const ContinuousFunction * function, Poincare::Context * context) {
+  if (m_expressionsAreCompiled) {
+    return;
+  }
+  static_assert(k_numberOfCompiledExpressions == ContinuousFunction::k_maxNumberOfComponents, "The cache should hold a compiled expression per component");
+  function->compileComponents(m_compiledExpressions, context);
+  m_expressionsAreCompiled = true;
+}
+
 Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i, int curveIndex) {
   assert(curveIndex == 0);
+  if (!hasValuesAtIndex(function, i)) {
+    storeValuesAtIndex(function, function->privateEvaluateXYAtParameter(t, context, curveIndex, m_compiledExpressions), i);
+  }
+  return cachedValuesAtIndex(function, t, i);
+}
+
+bool ContinuousFunctionCache::hasValuesAtIndex(const ContinuousFunction * function, int i) const {
   if (function->isAlongX()) {
-    if (IsSignalingNan(m_cache[i])) {
-      m_cache[i] = function->privateEvaluateXYAtParameter(t, context, curveIndex).x2();
-    }
-    return Poincare::Coordinate2D<float>(t, m_cache[i]);
+    return !IsSignalingNan(m_cache[i]);
   }
-  if (IsSignalingNan(m_cache[2 * i]) || IsSignalingNan(m_cache[2 * i + 1])) {
-    Poincare::Coordinate2D<float> res = function->privateEvaluateXYAtParameter(t, context, curveIndex);
-    m_cache[2 * i] = res.x1();
-    m_cache[2 * i + 1] = res.x2();
+  return !IsSignalingNan(m_cache[2 * i]) && !IsSignalingNan(m_cache[2 * i + 1]);
+}
+
+Poincare::Coordinate2D<float> ContinuousFunctionCache::cachedValuesAtIndex(const ContinuousFunction * function, float t, int i) const {
+  if (function->isAlongX()) {
+    return Poincare::Coordinate2D<float>(t, m_cache[i]);
   }
   return Poincare::Coordinate2D<float>(m_cache[2 * i], m_cache[2 * i + 1]);
 }
 
+void ContinuousFunctionCache::storeValuesAtIndex(const ContinuousFunction * function, Poincare::Coordinate2D<float> xy, int i) {
+  if (function->isAlongX()) {
+    m_cache[i] = xy.x2();
+    return;
+  }
+  m_cache[2 * i] = xy.x1();
+  m_cache[2 * i + 1] = xy.x2();
+}
+
 void ContinuousFunctionCache::pan(ContinuousFunction * function, float newTMin) {
   assert(function->isAlongX());
   if (newTMin == m_tMin) {
@@ -3,6 +3,7 @@
 
 #include "../graph/graph/graph_view.h"
 #include <ion/display.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/context.h>
 #include <poincare/coordinate_2D.h>
 
@@ -12,7 +13,7 @@ class ContinuousFunction;
 
 class ContinuousFunctionCache {
 public:
-  static constexpr int k_numberOfAvailableCaches = 2;
+  static constexpr int k_numberOfAvailableCaches = 4;
 
   static void PrepareForCaching(void * fun, ContinuousFunctionCache * cache, float tMin, float tStep);
 
@@ -21,6 +22,9 @@ public:
   float step() const { return m_tStep; }
   void clear();
   Poincare::Coordinate2D<float> valueForParameter(const ContinuousFunction * function, Poincare::Context * context, float t, int curveIndex);
+  /* Fill xy with the values at n <= CompiledExpression::k_maxBatchSize
+   * parameters. The values missing from the cache are evaluated at once. */
+  void valuesForParameters(const ContinuousFunction * function, Poincare::Context * context, const float * t, Poincare::Coordinate2D<float> * xy, int n, int curveIndex);
   // Sets step parameters for non-cartesian curves
   static void ComputeNonCartesianSteps(float * tStep, float * tCacheStep, float tMax, float tMin);
   // Signaling NAN, indicating a default cache value. See comment on k_sNAN
@@ -55,18 +59,29 @@ private:
    * The value 128*FLT_EPSILON has been found to be the lowest for which all
    * indices verify indexForParameter(tMin + index * tStep) = index. */
   static constexpr float k_cacheHitTolerance = 128.0f * FLT_EPSILON;
+  static constexpr int k_numberOfCompiledExpressions = 2;
 
   void invalidateBetween(int iInf, int iSup);
   void setRange(ContinuousFunction * function, float tMin, float tStep);
   int indexForParameter(const ContinuousFunction * function, float t, int curveIndex) const;
+  void compileExpressionsIfNeeded(const ContinuousFunction * function, Poincare::Context * context);
   Poincare::Coordinate2D<float> valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i, int curveIndex);
+  bool hasValuesAtIndex(const ContinuousFunction * function, int i) const;
+  Poincare::Coordinate2D<float> cachedValuesAtIndex(const ContinuousFunction * function, float t, int i) const;
+  void storeValuesAtIndex(const ContinuousFunction * function, Poincare::Coordinate2D<float> xy, int i);
   void pan(ContinuousFunction * function, float newTMin);
 
+  /* Compiled forms of the function's components, compiled lazily on the
+   * first evaluation after the cache has been cleared. They are used for
+   * every evaluation going through the cache, cached or not. */
+  Poincare::CompiledExpression m_compiledExpressions[k_numberOfCompiledExpressions];
+  bool m_expressionsAreCompiled;
   float m_tMin, m_tStep;
   float m_cache[k_sizeOfCache];
   /* m_startOfCache is used to implement a circular buffer for easy panning
    * with cartesian functions. When dealing with parametric or polar functions,
-   * m_startOfCache should be zero.*/
+   * m_startOfCache should be zero: their parameters only depend on the
+   * function's domain, so panning or zooming keeps their cache valid. */
   int m_startOfCache;
 };
 
@@ -646,7 +646,19 @@ const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
 
 constexpr static int k_maxNumberOfIterations = 10;
 
-void CurveView::drawCurve(KDContext * ctx, KDRect rect, const float tStart, float tEnd, const float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, KDColor colorOfFill, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation, bool dashedCurve, EvaluateXYForFloatParameter xyAreaBound, bool shouldColorAreaWhenNan, int areaPattern, Axis axis) const {
+static float curveParameterAtIndex(int i, float tStart, float tEnd, float tStep, bool * isLastSegment) {
+  float t = tStart + i * tStep;
+  if (t <= tStart) {
+    t = tStart + FLT_EPSILON;
+  }
+  if (t >= tEnd) {
+    t = tEnd - FLT_EPSILON;
+    *isLastSegment = true;
+  }
+  return t;
+}
+
+void CurveView::drawCurve(KDContext * ctx, KDRect rect, const float tStart, float tEnd, const float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, KDColor colorOfFill, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation, bool dashedCurve, EvaluateXYForFloatParameter xyAreaBound, bool shouldColorAreaWhenNan, int areaPattern, Axis axis, EvaluateXYForFloatParameters xyFloatBatchEvaluation) const {
   /* ContinuousFunction caching relies on a consistent tStart and tStep. These
    * values shouldn't be altered here. */
   float previousT = NAN;
@@ -658,23 +670,42 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, const float tStart, floa
   int i = 0;
   bool isLastSegment = false;
   int stampNumber = 0;
+  /* With a batch evaluation, the next parameters are evaluated together
+   * whenever the previous batch has been consumed. */
+  float batchT[k_evaluationBatchSize];
+  Coordinate2D<float> batchXY[k_evaluationBatchSize];
+  int batchLength = 0;
+  int batchIndex = 0;
   do {
     previousT = t;
-    t = tStart + (i++) * tStep;
-    if (t <= tStart) {
-      t = tStart + FLT_EPSILON;
-    }
-    if (t >= tEnd) {
-      t = tEnd - FLT_EPSILON;
-      isLastSegment = true;
-    }
+    t = curveParameterAtIndex(i++, tStart, tEnd, tStep, &isLastSegment);
     if (previousT == t) {
       // No need to draw segment. Happens when tStep << tStart .
       continue;
     }
     previousX = x;
     previousY = y;
-    Coordinate2D<float> xy = xyFloatEvaluation(t, model, context);
+    Coordinate2D<float> xy;
+    if (xyFloatBatchEvaluation) {
+      if (batchIndex == batchLength) {
+        batchIndex = 0;
+        batchLength = 0;
+        batchT[batchLength++] = t;
+        int nextIndex = i;
+        bool nextIsLastSegment = isLastSegment;
+        while (!nextIsLastSegment && batchLength < k_evaluationBatchSize) {
+          float nextT = curveParameterAtIndex(nextIndex++, tStart, tEnd, tStep, &nextIsLastSegment);
+          if (nextT != batchT[batchLength - 1]) {
+            batchT[batchLength++] = nextT;
+          }
+        }
+        xyFloatBatchEvaluation(batchT, batchXY, batchLength, model, context);
+      }
+      assert(batchT[batchIndex] == t);
+      xy = batchXY[batchIndex++];
+    } else {
+      xy = xyFloatEvaluation(t, model, context);
+    }
     x = xy.x1();
     y = xy.x2();
     float mainCoordinate = axis == Axis::Horizontal ? x : y;
@@ -696,7 +727,7 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, const float tStart, floa
   } while (!isLastSegment);
 }
 
-void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float tMin, float tMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, KDColor colorOfFill, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation, bool dashedCurve, EvaluateXYForFloatParameter xyAreaBound, bool shouldColorAreaWhenNan, int areaPattern, float cachedTStep, Axis axis) const {
+void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float tMin, float tMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, KDColor colorOfFill, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation, bool dashedCurve, EvaluateXYForFloatParameter xyAreaBound, bool shouldColorAreaWhenNan, int areaPattern, float cachedTStep, Axis axis, EvaluateXYForFloatParameters xyFloatBatchEvaluation) const {
   float tStart = tMin;
   float tStep = cachedTStep;
   KDCoordinate pixelMin = axis == Axis::Horizontal ? rect.left() - k_externRectMargin : rect.bottom() + k_externRectMargin;
@@ -717,7 +748,7 @@ void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float tMin, flo
   if (std::isinf(tStart) || std::isinf(tEnd) || tStart > tEnd) {
     return;
   }
-  drawCurve(ctx, rect, tStart, tEnd, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorOfFill, colorLowerBound, colorUpperBound, xyDoubleEvaluation, dashedCurve, xyAreaBound, shouldColorAreaWhenNan, areaPattern, axis);
+  drawCurve(ctx, rect, tStart, tEnd, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorOfFill, colorLowerBound, colorUpperBound, xyDoubleEvaluation, dashedCurve, xyAreaBound, shouldColorAreaWhenNan, areaPattern, axis, xyFloatBatchEvaluation);
 }
 
 static float polarThetaFromCoordinates(float x, float y, Preferences::AngleUnit angleUnit) {
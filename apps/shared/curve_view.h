@@ -18,10 +18,14 @@ public:
    * labels appear completely. This gives 3*charWidth/320 = 3*7/320= 0.066 */
   static constexpr float k_labelsHorizontalMarginRatio = 0.066f;
   static constexpr int k_numberOfPatternAreas = 4;
+  static constexpr int k_evaluationBatchSize = 16;
 
   typedef Poincare::Coordinate2D<float> (*EvaluateXYForFloatParameter)(float t, void * model, void * context);
   typedef Poincare::Coordinate2D<double> (*EvaluateXYForDoubleParameter)(double t, void * model, void * context);
   typedef float (*EvaluateYForX)(float x, void * model, void * context);
+  /* Optional batch counterpart of an EvaluateXYForFloatParameter, evaluating
+   * up to k_evaluationBatchSize parameters at once. */
+  typedef void (*EvaluateXYForFloatParameters)(const float * t, Poincare::Coordinate2D<float> * xy, int n, void * model, void * context);
 
   enum class Axis {
     Horizontal = 0,
@@ -122,8 +126,8 @@ protected:
   void drawAxes(KDContext * ctx, KDRect rect) const;
   void drawAxis(KDContext * ctx, KDRect rect, Axis axis) const { drawLine(ctx, rect, axis, 0.0f, KDColorBlack, 1); }
 
-  void drawCurve(KDContext * ctx, KDRect rect, const float tStart, float tEnd, const float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, KDColor colorOfFill = KDColorBlack, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr, bool dashedCurve = false, EvaluateXYForFloatParameter xyAreaBound = nullptr, bool shouldColorAreaWhenNan = false, int areaPattern = -1, Axis axis = Axis::Horizontal) const;
-  void drawCartesianCurve(KDContext * ctx, KDRect rect, float tMin, float tMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, KDColor colorOfFill = KDColorBlack, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr, bool dashedCurve = false, EvaluateXYForFloatParameter xyAreaBound = nullptr, bool shouldColorAreaWhenNan = false, int areaPattern = -1, float cachedTStep = 0.f, Axis axis = Axis::Horizontal) const;
+  void drawCurve(KDContext * ctx, KDRect rect, const float tStart, float tEnd, const float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, KDColor colorOfFill = KDColorBlack, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr, bool dashedCurve = false, EvaluateXYForFloatParameter xyAreaBound = nullptr, bool shouldColorAreaWhenNan = false, int areaPattern = -1, Axis axis = Axis::Horizontal, EvaluateXYForFloatParameters xyFloatBatchEvaluation = nullptr) const;
+  void drawCartesianCurve(KDContext * ctx, KDRect rect, float tMin, float tMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, KDColor colorOfFill = KDColorBlack, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr, bool dashedCurve = false, EvaluateXYForFloatParameter xyAreaBound = nullptr, bool shouldColorAreaWhenNan = false, int areaPattern = -1, float cachedTStep = 0.f, Axis axis = Axis::Horizontal, EvaluateXYForFloatParameters xyFloatBatchEvaluation = nullptr) const;
   void drawPolarCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr) const;
 
   void drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth, bool fillBar, KDColor defaultColor, KDColor highlightColor, KDCoordinate borderWidth = 0, KDColor borderColor = KDColorBlack, float highlightLowerBound = INFINITY, float highlightUpperBound = -INFINITY) const;
@@ -57,6 +57,36 @@ int Function::nameWithArgument(char * buffer, size_t bufferSize) {
   return result;
 }
 
+void Function::evaluateXYAtParameters(const float * t, Poincare::Coordinate2D<float> * xy, int n, Poincare::Context * context, int subCurveIndex, const Poincare::CompiledExpression * compiledExpressions) const {
+  for (int i = 0; i < n; i++) {
+    xy[i] = evaluateXYAtParameter(t[i], context, subCurveIndex);
+  }
+}
+
+Function::Sampler::Sampler(const Function * function, Poincare::Context * context) :
+  m_function(function)
+{
+  m_function->compileForSampling(m_compiledExpressions, context);
+}
+
+void Function::Sampler::Abscissas(const float * t, float * x, int n, Poincare::Context * context, const void * sampler) {
+  assert(n <= Poincare::Zoom::k_evaluationBatchSize);
+  Poincare::Coordinate2D<float> xy[Poincare::Zoom::k_evaluationBatchSize];
+  static_cast<const Sampler *>(sampler)->evaluateXYAtParameters(t, xy, n, context);
+  for (int i = 0; i < n; i++) {
+    x[i] = xy[i].x1();
+  }
+}
+
+void Function::Sampler::Ordinates(const float * t, float * y, int n, Poincare::Context * context, const void * sampler) {
+  assert(n <= Poincare::Zoom::k_evaluationBatchSize);
+  Poincare::Coordinate2D<float> xy[Poincare::Zoom::k_evaluationBatchSize];
+  static_cast<const Sampler *>(sampler)->evaluateXYAtParameters(t, xy, n, context);
+  for (int i = 0; i < n; i++) {
+    y[i] = xy[i].x2();
+  }
+}
+
 Function::RecordDataBuffer * Function::recordData() const {
   assert(!isNull());
   Ion::Storage::Record::Data d = value();
@@ -65,17 +95,21 @@ Function::RecordDataBuffer * Function::recordData() const {
 
 void Function::protectedFullRangeForDisplay(float tMin, float tMax, float tStep, float * min, float * max, Poincare::Context * context, bool xRange) const {
   Poincare::Zoom::ValueAtAbscissa evaluation;
+  Poincare::Zoom::ValuesAtAbscissas batchEvaluation;
   if (xRange) {
     evaluation = [](float x, Poincare::Context * context, const void * auxiliary) {
-      return static_cast<const Function *>(auxiliary)->evaluateXYAtParameter(x, context).x1();
+      return static_cast<const Sampler *>(auxiliary)->function()->evaluateXYAtParameter(x, context).x1();
     };
+    batchEvaluation = Sampler::Abscissas;
   } else {
     evaluation = [](float x, Poincare::Context * context, const void * auxiliary) {
-      return static_cast<const Function *>(auxiliary)->evaluateXYAtParameter(x, context).x2();
+      return static_cast<const Sampler *>(auxiliary)->function()->evaluateXYAtParameter(x, context).x2();
     };
+    batchEvaluation = Sampler::Ordinates;
   }
 
-  Poincare::Zoom::FullRange(evaluation, tMin, tMax, tStep, min, max, context, this);
+  Sampler sampler(this, context);
+  Poincare::Zoom::FullRange(evaluation, tMin, tMax, tStep, min, max, context, &sampler, batchEvaluation);
 }
 
 }
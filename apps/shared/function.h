@@ -2,6 +2,7 @@
 #define SHARED_FUNCTION_H
 
 #include "expression_model_handle.h"
+#include <poincare/compiled_expression.h>
 #include <poincare/function.h>
 #include <poincare/symbol.h>
 #include <escher/i18n.h>
@@ -47,6 +48,29 @@ public:
   // Evaluation
   virtual Poincare::Coordinate2D<float> evaluateXYAtParameter(float t, Poincare::Context * context, int subCurveIndex = 0) const = 0;
   virtual Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context, int subCurveIndex = 0) const = 0;
+  /* Evaluate XY at n parameters at once, as evaluateXYAtParameter would. The
+   * compiledExpressions are the ones prepared by a Sampler. */
+  virtual void evaluateXYAtParameters(const float * t, Poincare::Coordinate2D<float> * xy, int n, Poincare::Context * context, int subCurveIndex, const Poincare::CompiledExpression * compiledExpressions) const;
+  /* A Sampler prepares the batch evaluations of a Function once for a whole
+   * sampling pass, such as compiling its expressions, instead of doing it for
+   * each batch. It is meant to be given as auxiliary to the evaluations of
+   * the pass, and must not outlive the Function. */
+  class Sampler {
+  public:
+    Sampler(const Function * function, Poincare::Context * context);
+    const Function * function() const { return m_function; }
+    void evaluateXYAtParameters(const float * t, Poincare::Coordinate2D<float> * xy, int n, Poincare::Context * context, int subCurveIndex = 0) const {
+      m_function->evaluateXYAtParameters(t, xy, n, context, subCurveIndex, m_compiledExpressions);
+    }
+    /* Poincare::Zoom::ValuesAtAbscissas returning the abscissas or the
+     * ordinates of the first curve of the Sampler given as auxiliary. */
+    static void Abscissas(const float * t, float * x, int n, Poincare::Context * context, const void * sampler);
+    static void Ordinates(const float * t, float * y, int n, Poincare::Context * context, const void * sampler);
+    constexpr static int k_maxNumberOfCompiledExpressions = 2;
+  private:
+    const Function * m_function;
+    Poincare::CompiledExpression m_compiledExpressions[k_maxNumberOfCompiledExpressions];
+  };
   virtual Poincare::Expression sumBetweenBounds(double start, double end, Poincare::Context * context) const = 0;
 
   // Range
@@ -94,6 +118,8 @@ protected:
   };
 
   void protectedFullRangeForDisplay(float tMin, float tMax, float tStep, float * min, float * max, Poincare::Context * context, bool xRange) const;
+  // Fill compiledExpressions with what the batch evaluations of a Sampler use
+  virtual void compileForSampling(Poincare::CompiledExpression * compiledExpressions, Poincare::Context * context) const {}
   virtual void didBecomeInactive() {}
 
 private:
@@ -17,6 +17,13 @@ namespace Shared {
 
 constexpr const char * GlobalContext::k_extensions[];
 
+GlobalContext::GlobalContext() :
+  m_memoizedDefinitions{},
+  m_numberOfStorageChangesOfMemoizedDefinitions(Ion::Storage::FileSystem::sharedFileSystem()->numberOfChanges()),
+  m_numberOfAccesses(0)
+{
+}
+
 SequenceStore * GlobalContext::sequenceStore() {
   static SequenceStore sequenceStore;
   return &sequenceStore;
@@ -66,8 +73,15 @@ Context::SymbolAbstractType GlobalContext::expressionTypeForIdentifier(const cha
 }
 
 const Expression GlobalContext::expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone, float unknownSymbolValue ) {
-  Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
-  return ExpressionForSymbolAndRecord(symbol, r, this, unknownSymbolValue);
+  if (symbol.type() == ExpressionNode::Type::Sequence) {
+    Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
+    return ExpressionForSequence(symbol, r, this, unknownSymbolValue);
+  }
+  const MemoizedDefinition * definition = memoizedDefinition(symbol);
+  if (definition == nullptr) {
+    return Expression();
+  }
+  return ExpressionForDefinition(symbol.type(), definition->expression, symbol.type() == ExpressionNode::Type::Function ? symbol.childAtIndex(0) : Expression());
 }
 
 bool GlobalContext::setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) {
@@ -107,25 +121,40 @@ const Expression GlobalContext::ExpressionForSymbolAndRecord(const SymbolAbstrac
 }
 
 const Expression GlobalContext::ExpressionForActualSymbol(Ion::Storage::Record r) {
-  if (!r.hasExtension(Ion::Storage::expExtension)
-    && !r.hasExtension(Ion::Storage::lisExtension)
-    && !r.hasExtension(Ion::Storage::matExtension))
-  {
-    return Expression();
-  }
-  // An expression record value is the expression itself
-  Ion::Storage::Record::Data d = r.value();
-  return Expression::ExpressionFromAddress(d.buffer, d.size);
+  return ExpressionForDefinition(ExpressionNode::Type::Symbol, DefinitionOfRecord(ExpressionNode::Type::Symbol, r));
 }
 
 const Expression GlobalContext::ExpressionForFunction(const Expression & parameter, Ion::Storage::Record r) {
+  return ExpressionForDefinition(ExpressionNode::Type::Function, DefinitionOfRecord(ExpressionNode::Type::Function, r), parameter);
+}
+
+Ion::Storage::Record::Data GlobalContext::DefinitionOfRecord(ExpressionNode::Type symbolType, Ion::Storage::Record r) {
+  if (symbolType == ExpressionNode::Type::Symbol) {
+    if (!r.hasExtension(Ion::Storage::expExtension)
+      && !r.hasExtension(Ion::Storage::lisExtension)
+      && !r.hasExtension(Ion::Storage::matExtension))
+    {
+      return {.buffer = nullptr, .size = 0};
+    }
+    // An expression record value is the expression itself
+    return r.value();
+  }
+  assert(symbolType == ExpressionNode::Type::Function);
   if (!r.hasExtension(Ion::Storage::funcExtension)) {
+    return {.buffer = nullptr, .size = 0};
+  }
+  // An function record value has metadata before the equation
+  return ContinuousFunction(r).equationData();
+}
+
+const Expression GlobalContext::ExpressionForDefinition(ExpressionNode::Type symbolType, Ion::Storage::Record::Data definition, const Expression & parameter) {
+  if (definition.buffer == nullptr) {
     return Expression();
   }
-  /* An function record value has metadata before the expression. To get the
-   * expression, use the function record handle. */
-  Expression e = ContinuousFunction(r).expressionClone();
-  if (!e.isUninitialized()) {
+  Expression e = Expression::ExpressionFromAddress(definition.buffer, definition.size);
+  if (!e.isUninitialized() && symbolType == ExpressionNode::Type::Function) {
+    // The function is the right side of the stored equation
+    e = e.childAtIndex(1);
     e = e.replaceSymbolWithExpression(Symbol::Builder(UCodePointUnknown), parameter);
   }
   return e;
@@ -200,6 +229,44 @@ Ion::Storage::Record GlobalContext::SymbolAbstractRecordWithBaseName(const char
   return Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtensions(name, k_extensions, k_numberOfExtensions);
 }
 
+const GlobalContext::MemoizedDefinition * GlobalContext::memoizedDefinition(const SymbolAbstract & symbol) {
+  assert(symbol.type() == ExpressionNode::Type::Symbol || symbol.type() == ExpressionNode::Type::Function);
+  uint32_t numberOfStorageChanges = Ion::Storage::FileSystem::sharedFileSystem()->numberOfChanges();
+  if (numberOfStorageChanges != m_numberOfStorageChangesOfMemoizedDefinitions) {
+    // Records may have changed or moved
+    for (int i = 0; i < k_numberOfMemoizedDefinitions; i++) {
+      m_memoizedDefinitions[i].baseName = nullptr;
+    }
+    m_numberOfStorageChangesOfMemoizedDefinitions = numberOfStorageChanges;
+  }
+  const char * name = symbol.name();
+  size_t nameLength = strlen(name);
+  MemoizedDefinition * definition = m_memoizedDefinitions;
+  for (int i = 0; i < k_numberOfMemoizedDefinitions; i++) {
+    MemoizedDefinition * d = m_memoizedDefinitions + i;
+    if (!d->isEmpty() && d->symbolType == symbol.type() && d->baseNameLength == nameLength && strncmp(d->baseName, name, nameLength) == 0) {
+      d->lastAccess = ++m_numberOfAccesses;
+      return d;
+    }
+    // Replace an empty definition or else the least recently used one
+    if (!definition->isEmpty() && (d->isEmpty() || d->lastAccess < definition->lastAccess)) {
+      definition = d;
+    }
+  }
+
+  Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(name);
+  Ion::Storage::Record::Data expression = DefinitionOfRecord(symbol.type(), r);
+  if (expression.buffer == nullptr) {
+    return nullptr;
+  }
+  definition->baseName = r.name().baseName;
+  definition->baseNameLength = nameLength;
+  definition->symbolType = symbol.type();
+  definition->expression = expression;
+  definition->lastAccess = ++m_numberOfAccesses;
+  return definition;
+}
+
 void GlobalContext::tidyDownstreamPoolFrom(char * treePoolCursor) {
   sequenceStore()->tidyDownstreamPoolFrom(treePoolCursor);
 }
@@ -14,6 +14,8 @@ namespace Shared {
 
 class GlobalContext final : public Poincare::Context {
 public:
+  GlobalContext();
+
   constexpr static const char * k_extensions[] = {Ion::Storage::expExtension, Ion::Storage::matExtension, Ion::Storage::funcExtension, Ion::Storage::lisExtension, Ion::Storage::seqExtension};
   constexpr static int k_numberOfExtensions = sizeof(k_extensions) / sizeof(char *);
 
@@ -38,6 +40,10 @@ private:
   static const Poincare::Expression ExpressionForSymbolAndRecord(const Poincare::SymbolAbstract & symbol, Ion::Storage::Record r, Context * ctx, float unknownSymbolValue = NAN);
   static const Poincare::Expression ExpressionForActualSymbol(Ion::Storage::Record r);
   static const Poincare::Expression ExpressionForFunction(const Poincare::Expression & parameter, Ion::Storage::Record r);
+  /* Return where the definition of a symbol or a function is in its record, or
+   * a null buffer if the record does not define it. */
+  static Ion::Storage::Record::Data DefinitionOfRecord(Poincare::ExpressionNode::Type symbolType, Ion::Storage::Record r);
+  static const Poincare::Expression ExpressionForDefinition(Poincare::ExpressionNode::Type symbolType, Ion::Storage::Record::Data definition, const Poincare::Expression & parameter = Poincare::Expression());
   static const Poincare::Expression ExpressionForSequence(const Poincare::SymbolAbstract & symbol, Ion::Storage::Record r, Context * ctx, float unknownSymbolValue = NAN);
   // Expression setters
   static Ion::Storage::Record::ErrorStatus SetExpressionForActualSymbol(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol, Ion::Storage::Record previousRecord, Poincare::Context * context);
@@ -45,6 +51,27 @@ private:
   // Record getter
   static Ion::Storage::Record SymbolAbstractRecordWithBaseName(const char * name);
 
+  /* Memoized definitions
+   * Approximating an expression can look the same symbols and functions up
+   * many times, for instance in the integrand of an integral. Where their
+   * definitions are in the storage is kept until the storage changes, so that
+   * they are copied from there without looking the records up again. */
+  struct MemoizedDefinition {
+    bool isEmpty() const { return baseName == nullptr; }
+    // baseName points to the name of the record in the storage
+    const char * baseName;
+    size_t baseNameLength;
+    Poincare::ExpressionNode::Type symbolType;
+    Ion::Storage::Record::Data expression;
+    uint32_t lastAccess;
+  };
+  constexpr static int k_numberOfMemoizedDefinitions = 4;
+  // Return nullptr if symbol is not defined as a symbol or a function
+  const MemoizedDefinition * memoizedDefinition(const Poincare::SymbolAbstract & symbol);
+
+  MemoizedDefinition m_memoizedDefinitions[k_numberOfMemoizedDefinitions];
+  uint32_t m_numberOfStorageChangesOfMemoizedDefinitions;
+  uint32_t m_numberOfAccesses;
 };
 
 }
@@ -46,9 +46,10 @@ void InteractiveCurveViewRangeDelegate::DefaultImproveFullRange(float * xMin, fl
     ExpiringPointer<Function> f = functionStore->modelForRecord(functionStore->activeRecordAtIndex(0));
     if (!f->basedOnCostlyAlgorithms(context)) {
       Poincare::Zoom::ValueAtAbscissa evaluation = [](float x, Poincare::Context * context, const void * auxiliary) {
-        return static_cast<const Function *>(auxiliary)->evaluateXYAtParameter(x, context).x2();
+        return static_cast<const Function::Sampler *>(auxiliary)->function()->evaluateXYAtParameter(x, context).x2();
       };
-      Poincare::Zoom::ExpandSparseWindow(evaluation, xMin, xMax, yMin, yMax, context, f.operator->());
+      Function::Sampler sampler(f.operator->(), context);
+      Poincare::Zoom::ExpandSparseWindow(evaluation, xMin, xMax, yMin, yMax, context, &sampler, Function::Sampler::Ordinates);
     }
   }
 }
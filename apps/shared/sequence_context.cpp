@@ -2,21 +2,32 @@
 #include "sequence_store.h"
 #include "sequence_cache_context.h"
 #include "../shared/poincare_helpers.h"
+#include <algorithm>
 #include <cmath>
+#include <string.h>
 
 using namespace Poincare;
 
 namespace Shared {
 
 template<typename T>
-TemplatedSequenceContext<T>::TemplatedSequenceContext() :
+TemplatedSequenceContext<T>::TemplatedSequenceContext(SequenceStore * sequenceStore) :
   m_commonRank(-1),
   m_commonRankValues{{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}},
+  m_checkpoints(sequenceStore->rankCheckpoints<T>()),
   m_independentRanks{-1, -1, -1},
   m_independentRankValues{{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}}
 {
 }
 
+template<typename T>
+TemplatedSequenceContext<T>::~TemplatedSequenceContext() {
+  // Another context could be built at the same address
+  if (m_checkpoints->owner == this) {
+    m_checkpoints->owner = nullptr;
+  }
+}
+
 template<typename T>
 T TemplatedSequenceContext<T>::valueOfCommonRankSequenceAtPreviousRank(int sequenceIndex, int rank) const {
   return m_commonRankValues[sequenceIndex][rank];
@@ -29,6 +40,9 @@ void TemplatedSequenceContext<T>::resetCache() {
    * values stored in m_commomValues and m_independentRankValues are dirty
    * and do not use them. */
   m_commonRank = -1;
+  if (m_checkpoints->owner == this) {
+    m_checkpoints->numberOfCheckpoints = 0;
+  }
   for (int i = 0; i < SequenceStore::k_maxNumberOfSequences; i ++) {
     m_independentRanks[i] = -1;
   }
@@ -42,12 +56,42 @@ bool TemplatedSequenceContext<T>::iterateUntilRank(int n, SequenceStore * sequen
   if (n < 0 || n-m_commonRank > k_maxRecurrentRank) {
     return false;
   }
+  restoreClosestCheckpointBelow(n);
   while (m_commonRank < n) {
     step(sqctx);
+    saveCheckpoint();
   }
   return true;
 }
 
+template<typename T>
+void TemplatedSequenceContext<T>::saveCheckpoint() {
+  if (m_commonRank < k_checkpointInterval || m_commonRank % k_checkpointInterval != 0) {
+    return;
+  }
+  if (m_checkpoints->owner != this) {
+    // Drop the checkpoints of the previous owner
+    m_checkpoints->owner = this;
+    m_checkpoints->numberOfCheckpoints = 0;
+  }
+  int numberOfCheckpoints = m_checkpoints->numberOfCheckpoints;
+  if (m_commonRank == (numberOfCheckpoints + 1) * k_checkpointInterval && numberOfCheckpoints < k_maxNumberOfCheckpoints) {
+    memcpy(m_checkpoints->values[numberOfCheckpoints], m_commonRankValues, sizeof(RankValues));
+    m_checkpoints->numberOfCheckpoints++;
+  }
+}
+
+template<typename T>
+void TemplatedSequenceContext<T>::restoreClosestCheckpointBelow(int n) {
+  int checkpoint = std::min(n / k_checkpointInterval, numberOfCheckpoints());
+  int checkpointRank = checkpoint * k_checkpointInterval;
+  if (checkpoint == 0 || checkpointRank <= m_commonRank) {
+    return;
+  }
+  m_commonRank = checkpointRank;
+  memcpy(m_commonRankValues, m_checkpoints->values[checkpoint - 1], sizeof(RankValues));
+}
+
 template<typename T>
 void TemplatedSequenceContext<T>::step(SequenceContext * sqctx, int sequenceIndex) {
   // First we increment the rank
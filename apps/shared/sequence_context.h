@@ -13,7 +13,8 @@ class Sequence;
 template<typename T>
 class TemplatedSequenceContext {
 public:
-  TemplatedSequenceContext();
+  TemplatedSequenceContext(SequenceStore * sequenceStore);
+  ~TemplatedSequenceContext();
   T valueOfCommonRankSequenceAtPreviousRank(int sequenceIndex, int rank) const;
   void resetCache();
   bool iterateUntilRank(int n, SequenceStore * sequenceStore, SequenceContext * sqctx);
@@ -41,9 +42,22 @@ private:
    * values of each sequence at independent rank. This means that
    * (u(3), v(5), w(10)) can be computed at the same time.
    * This cache is therefore used for independent steps of sequences
+   *
+   * Besides, the common rank values are saved every k_checkpointInterval ranks
+   * while iterating, in the sequence store. When a lower rank is asked for, or
+   * a rank far above the common rank, we restart from the closest checkpoint
+   * below it instead of iterating from the first rank.
    */
+  constexpr static int k_checkpointInterval = SequenceStore::k_rankCheckpointInterval;
+  constexpr static int k_maxNumberOfCheckpoints = k_maxRecurrentRank / k_checkpointInterval;
+  static_assert(k_maxNumberOfCheckpoints <= SequenceStore::k_maxNumberOfRankCheckpoints, "The sequence store cannot hold all the checkpoints");
+  typedef typename SequenceStore::RankCheckpoints<T>::RankValues RankValues;
+  int numberOfCheckpoints() const { return m_checkpoints->owner == this ? m_checkpoints->numberOfCheckpoints : 0; }
+  void saveCheckpoint();
+  void restoreClosestCheckpointBelow(int n);
   int m_commonRank;
-  T m_commonRankValues[SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth+1];
+  RankValues m_commonRankValues;
+  SequenceStore::RankCheckpoints<T> * m_checkpoints;
 
   // Used for fixed computations
   int m_independentRanks[SequenceStore::k_maxNumberOfSequences];
@@ -54,6 +68,8 @@ class SequenceContext : public Poincare::ContextWithParent {
 public:
   SequenceContext(Poincare::Context * parentContext, SequenceStore * sequenceStore) :
     ContextWithParent(parentContext),
+    m_floatSequenceContext(sequenceStore),
+    m_doubleSequenceContext(sequenceStore),
     m_sequenceStore(sequenceStore) {}
   /* u{n}, v{n} and w{n} must be parsed as sequences in the sequence app
    * so that u{n} can be defined as a function of v{n} without v{n} being
@@ -30,6 +30,23 @@ public:
   constexpr static int k_maxRecurrenceDepth = 2;
   Sequence sequenceAtIndex(int i) { assert(i < SequenceStore::k_maxNumberOfSequences && i >= 0); return m_sequences[i]; }
 
+  /* While iterating, the sequence contexts save the values of all the
+   * sequences every k_rankCheckpointInterval ranks. Some sequence contexts
+   * are built on the stack, so the saved values are kept here. Only the
+   * context that saved them, the owner, uses them. */
+  constexpr static int k_rankCheckpointInterval = 250;
+  constexpr static int k_maxNumberOfRankCheckpoints = 40;
+  template<typename T>
+  struct RankCheckpoints {
+    typedef T RankValues[k_maxNumberOfSequences][k_maxRecurrenceDepth+1];
+    const void * owner = nullptr;
+    int numberOfCheckpoints = 0;
+    // values[i] holds the values at rank (i+1)*k_rankCheckpointInterval
+    RankValues values[k_maxNumberOfRankCheckpoints];
+  };
+  // Defined for float and double only, below
+  template<typename T> RankCheckpoints<T> * rankCheckpoints();
+
 private:
   int maxNumberOfMemoizedModels() const override { return SequenceStore::k_maxNumberOfSequences; }
   const char * modelExtension() const override { return Ion::Storage::seqExtension; }
@@ -45,8 +62,13 @@ private:
   Shared::ExpressionModelHandle * setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record record) const override;
   Shared::ExpressionModelHandle * memoizedModelAtIndex(int cacheIndex) const override;
   mutable Sequence m_sequences[k_maxNumberOfSequences];
+  RankCheckpoints<float> m_floatRankCheckpoints;
+  RankCheckpoints<double> m_doubleRankCheckpoints;
 };
 
+template<> inline SequenceStore::RankCheckpoints<float> * SequenceStore::rankCheckpoints<float>() { return &m_floatRankCheckpoints; }
+template<> inline SequenceStore::RankCheckpoints<double> * SequenceStore::rankCheckpoints<double>() { return &m_doubleRankCheckpoints; }
+
 }
 
 #endif
@@ -479,18 +479,40 @@ double Store::sumOfValuesBetween(int series, double x1, double x2, bool strictUp
    * must be higher than 1e-14 (max number of significant digits) but having it
    * higher than DBL_EPSILON wouldn't be effective. */
   constexpr static double k_precision = 1e-15;
-  double result = 0;
-  int numberOfPairs = numberOfPairsOfSeries(series);
-  for (int k = 0; k < numberOfPairs; k++) {
-    int sortedIndex = valueIndexAtSortedIndex(series, k);
-    double value = get(series, 0, sortedIndex);
-    if (value > x2 || (strictUpperBound && Poincare::Helpers::RelativelyEqual<double>(value, x2, k_precision))) {
-      break;
-    }
-    if (value >= x1 || Poincare::Helpers::RelativelyEqual<double>(value, x1, k_precision)) {
-      result += get(series, 1, sortedIndex);
+  /* Values are sorted, so the values in the interval are the ones between the
+   * first value reaching x1 and the first value exceeding x2. */
+  int start = firstSortedIndexSuchThat(series, [](double value, double x1) {
+      return value >= x1 || Poincare::Helpers::RelativelyEqual<double>(value, x1, k_precision);
+    }, x1);
+  int end = strictUpperBound ?
+    firstSortedIndexSuchThat(series, [](double value, double x2) {
+      return value > x2 || Poincare::Helpers::RelativelyEqual<double>(value, x2, k_precision);
+    }, x2) :
+    firstSortedIndexSuchThat(series, [](double value, double x2) { return value > x2; }, x2);
+  return sumOfFrequenciesBetweenSortedIndexes(series, start, end);
+}
+
+int Store::firstSortedIndexSuchThat(int series, bool (*test)(double value, double bound), double bound) const {
+  int lower = 0;
+  int upper = numberOfPairsOfSeries(series);
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (test(get(series, 0, valueIndexAtSortedIndex(series, middle)), bound)) {
+      upper = middle;
+    } else {
+      lower = middle + 1;
     }
   }
+  return lower;
+}
+
+double Store::sumOfFrequenciesBetweenSortedIndexes(int series, int start, int end) const {
+  /* The frequencies are summed rather than read as a difference of cumulated
+   * frequencies, which would not give back the exact sum of a range. */
+  double result = 0.0;
+  for (int k = start; k < end; k++) {
+    result += get(series, 1, valueIndexAtSortedIndex(series, k));
+  }
   return result;
 }
 
@@ -565,16 +587,10 @@ double Store::cumulatedFrequencyValueAtIndex(int series, int i) const {
 }
 
 double Store::cumulatedFrequencyResultAtIndex(int series, int i) const {
-  double cumulatedOccurrences = 0.0;
-  int index = 0;
   const double value = cumulatedFrequencyValueAtIndex(series, i);
-  const int numberOfPairs = numberOfPairsOfSeries(series);
-  while (index < numberOfPairs && get(series, 0, valueIndexAtSortedIndex(series, index)) <= value) {
-    cumulatedOccurrences += get(series, 1, valueIndexAtSortedIndex(series, index));
-    index++;
-  }
+  int end = firstSortedIndexSuchThat(series, [](double v, double value) { return v > value; }, value);
   // Taking advantage of sumOfOccurrences being memoized.
-  return 100.0 * cumulatedOccurrences / sumOfOccurrences(series);
+  return 100.0 * sumOfFrequenciesBetweenSortedIndexes(series, 0, end) / sumOfOccurrences(series);
 }
 
 int Store::totalNormalProbabilityValues(int series) const {
@@ -157,6 +157,10 @@ private:
   uint8_t upperWhiskerSortedIndex(int series) const;
   // Return the value index from its sorted index (a 0 sorted index is the min)
   uint8_t valueIndexAtSortedIndex(int series, int i) const;
+  // Return the first sorted index whose value passes the test, by dichotomy
+  int firstSortedIndexSuchThat(int series, bool (*test)(double value, double bound), double bound) const;
+  // Return the sum of the frequencies of the values at sorted indexes in [start, end)
+  double sumOfFrequenciesBetweenSortedIndexes(int series, int start, int end) const;
   bool frequenciesAreValid(int series) const;
 
   UserPreferences * m_userPreferences;
@@ -983,4 +983,39 @@ QUIZ_CASE(data_statistics_histograms) {
   }
 }
 
+QUIZ_CASE(data_statistics_sum_of_values_between) {
+  GlobalContext context;
+  UserPreferences userPreferences;
+  Store store(&context, &userPreferences);
+
+  constexpr int listLength = 7;
+  double v[listLength] = {3.0, -1.0, 12.11, 3.0, 0.0, 7.5, -1.0};
+  double n[listLength] = {2.0, 1.0, 4.0, 0.5, 3.0, 0.0, 6.0};
+  setStoreData(&store, v, n, listLength, k_defaultSeriesIndex);
+
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, -DBL_MAX, DBL_MAX) == 16.5);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, -1.0, 3.0) == 10.0);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, -1.0, 3.0, false) == 12.5);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, 3.0, 12.0) == 2.5);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, 4.0, 7.0) == 0.0);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, 20.0, 30.0) == 0.0);
+  // Bounds are compared with a relative precision
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, 12.109999999999999, 13.0) == 4.0);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, 0.0, 12.110000000000001) == 5.5);
+  quiz_assert(store.cumulatedFrequencyResultAtIndex(k_defaultSeriesIndex, 2) == 100.0 * 12.5 / 16.5);
+
+  // The sums follow the modifications of the data
+  store.set(2.0, k_defaultSeriesIndex, 1, 4);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, -1.0, 3.0) == 9.0);
+
+  // The frequencies of a range are summed exactly
+  double v2[3] = {1.0, 2.0, 3.0};
+  double n2[3] = {0.1, 0.2, 0.3};
+  setStoreData(&store, v2, n2, 3, k_defaultSeriesIndex);
+  quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, 2.0, 3.0, false) == 0.2 + 0.3);
+
+  // Empty out the store
+  setStoreData(&store, {}, {}, 0, k_defaultSeriesIndex);
+}
+
 }
@@ -0,0 +1,48 @@
+#ifndef ESCHER_DIRTY_REGION_H
+#define ESCHER_DIRTY_REGION_H
+
+#include <kandinsky/point.h>
+#include <kandinsky/rect.h>
+#include <stdint.h>
+
+namespace Escher {
+
+/* A DirtyRegion is a small set of disjoint rectangles that need to be redrawn.
+ * Each rectangle is redrawn on its own, so that two small changes far from
+ * each other do not repaint their whole bounding box. Rectangles are merged
+ * when they intersect, since translucent views such as the round cursor blend
+ * over what they read back and must not be drawn twice. They are also merged
+ * when drawing their union costs no more pixels than drawing them apart, or
+ * when there is no room left, in which case the union that grows the least is
+ * picked. */
+
+class DirtyRegion {
+public:
+  constexpr static int k_maxNumberOfRects = 2;
+
+  DirtyRegion() : m_rects{KDRectZero, KDRectZero}, m_numberOfRects(0) {}
+  DirtyRegion(KDRect rect) : DirtyRegion() { add(rect); }
+
+  int numberOfRects() const { return m_numberOfRects; }
+  KDRect rectAtIndex(int i) const;
+  bool isEmpty() const { return m_numberOfRects == 0; }
+  KDRect bounds() const;
+
+  void add(KDRect rect);
+  void add(const DirtyRegion & region);
+  void reset() { m_numberOfRects = 0; }
+  DirtyRegion translatedBy(KDPoint p) const;
+  DirtyRegion intersectedWith(KDRect rect) const;
+
+private:
+  static uint32_t Area(KDRect rect) { return static_cast<uint32_t>(rect.width()) * static_cast<uint32_t>(rect.height()); }
+  void removeRectAtIndex(int i);
+
+  KDRect m_rects[k_maxNumberOfRects];
+  static_assert(k_maxNumberOfRects == 2, "DirtyRegion constructor initializes two rectangles");
+  uint8_t m_numberOfRects;
+};
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef ESCHER_VIEW_H
 #define ESCHER_VIEW_H
 
+#include <escher/dirty_region.h>
 #include <kandinsky/context.h>
 #include <kandinsky/point.h>
 #include <kandinsky/rect.h>
@@ -36,7 +37,7 @@ class View {
   friend class TransparentView;
   friend class Shared::RoundCursorView;
 public:
-  View() : m_frame(KDRectZero), m_superview(nullptr), m_dirtyRect(KDRectZero) {}
+  View() : m_frame(KDRectZero), m_superview(nullptr) {}
 
   void resetSuperview() {
     m_superview = nullptr;
@@ -81,7 +82,7 @@ protected:
 private:
   virtual void layoutSubviews(bool force = false) {}
   virtual const Window * window() const;
-  KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  DirtyRegion redraw(KDRect rect, const DirtyRegion & forceRedrawRegion = DirtyRegion());
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
 
@@ -92,7 +93,7 @@ private:
    * Otherwise, we would just have to implement the destructor to notify
    * subviews that 'm_superview = nullptr'. */
   View * m_superview;
-  KDRect m_dirtyRect;
+  DirtyRegion m_dirtyRegion;
 };
 
 }
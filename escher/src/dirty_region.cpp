@@ -0,0 +1,84 @@
+#include <escher/dirty_region.h>
+#include <assert.h>
+
+namespace Escher {
+
+KDRect DirtyRegion::rectAtIndex(int i) const {
+  assert(i >= 0 && i < m_numberOfRects);
+  return m_rects[i];
+}
+
+KDRect DirtyRegion::bounds() const {
+  KDRect result = KDRectZero;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    result = result.unionedWith(m_rects[i]);
+  }
+  return result;
+}
+
+void DirtyRegion::add(KDRect rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  int i = 0;
+  while (i < m_numberOfRects) {
+    KDRect merged = m_rects[i].unionedWith(rect);
+    if (m_rects[i].intersects(rect) || Area(merged) <= Area(m_rects[i]) + Area(rect)) {
+      /* The rectangles overlap, or drawing the union is not more expensive:
+       * merge, and start over since the union may now overlap another
+       * rectangle. */
+      removeRectAtIndex(i);
+      rect = merged;
+      i = 0;
+      continue;
+    }
+    i++;
+  }
+  if (m_numberOfRects < k_maxNumberOfRects) {
+    m_rects[m_numberOfRects++] = rect;
+    return;
+  }
+  // No room left, merge with the rectangle whose union grows the least
+  int bestIndex = 0;
+  uint32_t bestGrowth = UINT32_MAX;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    uint32_t growth = Area(m_rects[i].unionedWith(rect)) - Area(m_rects[i]);
+    if (growth < bestGrowth) {
+      bestGrowth = growth;
+      bestIndex = i;
+    }
+  }
+  KDRect merged = m_rects[bestIndex].unionedWith(rect);
+  removeRectAtIndex(bestIndex);
+  add(merged);
+}
+
+void DirtyRegion::add(const DirtyRegion & region) {
+  for (int i = 0; i < region.m_numberOfRects; i++) {
+    add(region.m_rects[i]);
+  }
+}
+
+DirtyRegion DirtyRegion::translatedBy(KDPoint p) const {
+  DirtyRegion result;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    result.m_rects[i] = m_rects[i].translatedBy(p);
+  }
+  result.m_numberOfRects = m_numberOfRects;
+  return result;
+}
+
+DirtyRegion DirtyRegion::intersectedWith(KDRect rect) const {
+  DirtyRegion result;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    result.add(m_rects[i].intersectedWith(rect));
+  }
+  return result;
+}
+
+void DirtyRegion::removeRectAtIndex(int i) {
+  assert(i >= 0 && i < m_numberOfRects);
+  m_rects[i] = m_rects[--m_numberOfRects];
+}
+
+}
@@ -16,46 +16,49 @@ const Window * View::window() const {
 }
 
 void View::markRectAsDirty(KDRect rect) {
-  m_dirtyRect = m_dirtyRect.unionedWith(rect);
+  m_dirtyRegion.add(rect);
 }
 
-KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
+DirtyRegion View::redraw(KDRect rect, const DirtyRegion & forceRedrawRegion) {
   /* View::redraw recursively redraws the rectangle 'rect' of the view and all
    * its subviews.
    * To optimize the function, we redraw only the union of the current dirty
-   * rectangle with a rectangle forced to be redrawn (forceRedrawRect). This
-   * rectangle is initially empty and recursively expands by unioning with the
-   * rectangles that are redrawn. This process handles the case when several
+   * region with a region forced to be redrawn (forceRedrawRegion). This
+   * region is initially empty and recursively expands by unioning with the
+   * regions that are redrawn. This process handles the case when several
    * sister views are overlapping (provided that the sister views are indexed in
    * the right order).
+   * Regions are made of a few rectangles which are drawn separately, so that
+   * distant dirty areas do not repaint their whole bounding box.
   */
   if (window() == nullptr) {
     /* That view (and all of its subviews) is offscreen. That means so are all
      * of its subviews. So there's no point in drawing them. */
-    return KDRectZero;
+    return DirtyRegion();
   }
 
-  /* First, for the current view, the rectangle to redraw is the union of the
-   * dirty rectangle and the rectangle forced to be redrawn. The rectangle to
-   * redraw must also be included in the current view bounds and in the
-   * rectangle rect. */
-  KDRect rectNeedingRedraw = rect
-    .intersectedWith(m_dirtyRect)
-    .unionedWith(forceRedrawRect
-      .intersectedWith(bounds()));
-
-  // This redraws the rectNeedingRedraw calling drawRect.
-  if (!rectNeedingRedraw.isEmpty()) {
+  /* First, for the current view, the region to redraw is the union of the
+   * dirty region and the region forced to be redrawn. The region to redraw
+   * must also be included in the current view bounds and in the rectangle
+   * rect. */
+  DirtyRegion regionNeedingRedraw = m_dirtyRegion.intersectedWith(rect);
+  regionNeedingRedraw.add(forceRedrawRegion.intersectedWith(bounds()));
+
+  // This redraws each rectangle of regionNeedingRedraw calling drawRect.
+  if (!regionNeedingRedraw.isEmpty()) {
     KDPoint absOrigin = absoluteOrigin();
-    KDRect absRect = rectNeedingRedraw.translatedBy(absOrigin);
-    KDRect absClippingRect = absoluteVisibleFrame().intersectedWith(absRect);
+    KDRect absVisibleFrame = absoluteVisibleFrame();
     KDContext * ctx = KDIonContext::sharedContext();
-    ctx->setOrigin(absOrigin);
-    ctx->setClippingRect(absClippingRect);
-    this->drawRect(ctx, rectNeedingRedraw);
+    for (int i = 0; i < regionNeedingRedraw.numberOfRects(); i++) {
+      KDRect rectNeedingRedraw = regionNeedingRedraw.rectAtIndex(i);
+      KDRect absClippingRect = absVisibleFrame.intersectedWith(rectNeedingRedraw.translatedBy(absOrigin));
+      ctx->setOrigin(absOrigin);
+      ctx->setClippingRect(absClippingRect);
+      this->drawRect(ctx, rectNeedingRedraw);
+    }
   }
   // This initializes the area that has been redrawn.
-  KDRect redrawnArea = rectNeedingRedraw;
+  DirtyRegion redrawnArea = regionNeedingRedraw;
 
   // Then, let's recursively draw our children over ourself
   for (uint8_t i=0; i<numberOfSubviews(); i++) {
@@ -69,19 +72,19 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     KDRect intersectionInSubview = rect
       .intersectedWith(subview->m_frame)
       .translatedBy(subview->m_frame.origin().opposite());
-    KDRect forcedRedrawAreaInSubview = redrawnArea
+    DirtyRegion forcedRedrawAreaInSubview = redrawnArea
       .translatedBy(subview->m_frame.origin().opposite());
 
-    // We redraw the current subview by passing the rectangle previously redrawn
+    // We redraw the current subview by passing the region previously redrawn
     // (by the parent view or previous sister views) as forced to be redraw.
-    KDRect subviewRedrawnArea =
+    DirtyRegion subviewRedrawnArea =
       subview->redraw(intersectionInSubview, forcedRedrawAreaInSubview);
 
     // We expand the redrawn area to include the area just drawn.
-    redrawnArea = redrawnArea.unionedWith(subviewRedrawnArea.translatedBy(subview->m_frame.origin()));
+    redrawnArea.add(subviewRedrawnArea.translatedBy(subview->m_frame.origin()));
   }
   // Eventually, mark that we don't need to be redrawn
-  m_dirtyRect = KDRectZero;
+  m_dirtyRegion.reset();
 
   // The function returns the total area that have been redrawn.
   return redrawnArea;
@@ -122,7 +125,7 @@ void View::setFrame(KDRect frame, bool force) {
    * can either mark an area of our superview as dirty, or mark our whole frame
    * as dirty. We pick the second option because it is more efficient. */
   markRectAsDirty(bounds());
-  // FIXME: m_dirtyRect = bounds(); would be more correct (in case the view is being shrinked)
+  // FIXME: m_dirtyRegion = bounds(); would be more correct (in case the view is being shrinked)
 
   if (!m_frame.isEmpty()) {
     layoutSubviews(force);
@@ -0,0 +1,90 @@
+#include <quiz.h>
+#include <escher/dirty_region.h>
+
+using namespace Escher;
+
+void assert_region_is(const DirtyRegion & region, const KDRect * rects, int numberOfRects) {
+  quiz_assert(region.numberOfRects() == numberOfRects);
+  for (int i = 0; i < numberOfRects; i++) {
+    bool found = false;
+    for (int j = 0; j < numberOfRects; j++) {
+      found = found || region.rectAtIndex(j) == rects[i];
+    }
+    quiz_assert(found);
+  }
+}
+
+QUIZ_CASE(escher_dirty_region_distant_rects_are_kept_apart) {
+  DirtyRegion region;
+  quiz_assert(region.isEmpty());
+  region.add(KDRectZero);
+  quiz_assert(region.isEmpty());
+  // A cursor and the battery icon at opposite corners
+  region.add(KDRect(10, 200, 4, 8));
+  region.add(KDRect(300, 5, 12, 6));
+  const KDRect expected[] = {KDRect(10, 200, 4, 8), KDRect(300, 5, 12, 6)};
+  assert_region_is(region, expected, 2);
+  quiz_assert(region.bounds() == KDRect(10, 5, 302, 203));
+}
+
+QUIZ_CASE(escher_dirty_region_overlapping_rects_are_merged) {
+  DirtyRegion region;
+  region.add(KDRect(0, 0, 10, 10));
+  region.add(KDRect(5, 0, 10, 10));
+  const KDRect merged[] = {KDRect(0, 0, 15, 10)};
+  assert_region_is(region, merged, 1);
+  // Contained rectangles do not add anything
+  region.add(KDRect(2, 2, 3, 3));
+  assert_region_is(region, merged, 1);
+  // Adjacent rectangles cost the same drawn together
+  region.add(KDRect(15, 0, 5, 10));
+  const KDRect adjacent[] = {KDRect(0, 0, 20, 10)};
+  assert_region_is(region, adjacent, 1);
+  region.reset();
+  quiz_assert(region.isEmpty());
+}
+
+QUIZ_CASE(escher_dirty_region_full_region_merges_cheapest_union) {
+  DirtyRegion region;
+  region.add(KDRect(0, 0, 10, 10));
+  region.add(KDRect(200, 200, 10, 10));
+  quiz_assert(region.numberOfRects() == DirtyRegion::k_maxNumberOfRects);
+  region.add(KDRect(20, 0, 10, 10));
+  const KDRect expected[] = {KDRect(0, 0, 30, 10), KDRect(200, 200, 10, 10)};
+  assert_region_is(region, expected, 2);
+  // Another rectangle is merged with the one its union grows the least
+  region.add(KDRect(40, 150, 10, 10));
+  const KDRect grown[] = {KDRect(0, 0, 50, 160), KDRect(200, 200, 10, 10)};
+  assert_region_is(region, grown, 2);
+}
+
+QUIZ_CASE(escher_dirty_region_intersecting_rects_are_merged) {
+  DirtyRegion region;
+  region.add(KDRect(0, 0, 100, 10));
+  // Drawing the union costs more, but the overlap must not be drawn twice
+  region.add(KDRect(0, 0, 10, 100));
+  const KDRect merged[] = {KDRect(0, 0, 100, 100)};
+  assert_region_is(region, merged, 1);
+}
+
+QUIZ_CASE(escher_dirty_region_merges_cascade) {
+  DirtyRegion region;
+  region.add(KDRect(0, 0, 100, 100));
+  region.add(KDRect(120, 0, 100, 100));
+  quiz_assert(region.numberOfRects() == 2);
+  // Bridging the gap merges the first rectangle, then the union the second
+  region.add(KDRect(90, 0, 40, 100));
+  const KDRect all[] = {KDRect(0, 0, 220, 100)};
+  assert_region_is(region, all, 1);
+}
+
+QUIZ_CASE(escher_dirty_region_translation_and_intersection) {
+  DirtyRegion region(KDRect(0, 0, 10, 10));
+  region.add(KDRect(100, 100, 10, 10));
+  DirtyRegion translated = region.translatedBy(KDPoint(5, -5));
+  const KDRect expectedTranslation[] = {KDRect(5, -5, 10, 10), KDRect(105, 95, 10, 10)};
+  assert_region_is(translated, expectedTranslation, 2);
+  DirtyRegion intersection = region.intersectedWith(KDRect(0, 0, 50, 50));
+  const KDRect expectedIntersection[] = {KDRect(0, 0, 10, 10)};
+  assert_region_is(intersection, expectedIntersection, 1);
+}
@@ -36,6 +36,15 @@ public:
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
   uint32_t checksum();
 
+  /* Count the changes of the records and of their place in the buffer, so
+   * that pointers to records can be kept until the next change. */
+  uint32_t numberOfChanges() const { return m_numberOfChanges; }
+
+  /* The buffer can be written without the FileSystem, when a storage is
+   * uploaded through DFU. Records must then be indexed again and the pointers
+   * to records kept by the apps must be dropped. */
+  void reloadAfterExternalChange();
+
   // Storage delegate
   void setDelegate(StorageDelegate * delegate) { m_delegate = delegate; }
   void notifyChangeToDelegate(const Record r = Record()) const;
@@ -131,6 +140,10 @@ private:
   char * endBuffer();
   size_t sizeOfRecordWithName(Record::Name name, size_t dataSize);
   bool slideBuffer(char * position, int delta);
+  bool isInBuffer(const void * data) const { return data >= m_buffer && data < m_buffer + k_storageSize; }
+  /* Let the delegate destroy the records it can do without, to make room for
+   * another record. Return true if records were destroyed. */
+  bool freeSpaceFromDelegate(const Record recordToKeep = Record());
   class RecordIterator {
   public:
     RecordIterator(char * start) : m_recordStart(start) {}
@@ -148,6 +161,29 @@ private:
   };
   RecordIterator end() const { return RecordIterator(nullptr); }
 
+  /* Records index
+   * A record is identified by the CRC32 of its full name, so the offsets of
+   * the records in m_buffer are indexed by CRC32, sorted to be found by binary
+   * search. The number of records of each extension is also kept. Both are
+   * updated on each change of the buffer. If there are too many records or
+   * extensions, the index is incomplete and lookups that miss it fall back to
+   * walking the buffer. */
+  constexpr static int k_maxNumberOfIndexedRecords = 64;
+  constexpr static int k_maxNumberOfCountedExtensions = 8;
+  struct ExtensionCount {
+    uint32_t extensionCRC32;
+    record_size_t numberOfRecords;
+  };
+  static uint32_t ExtensionCRC32(const char * extension);
+  // Return the position of crc32 in m_indexedCRC32, or where to insert it
+  int indexPositionOfCRC32(uint32_t crc32) const;
+  char * indexedPointerOfRecord(const Record record) const;
+  ExtensionCount * extensionCount(const char * extension, bool createIfMissing = false);
+  void indexRecord(char * recordStart);
+  void unindexRecord(char * recordStart);
+  void indexRecordsMoved(char * position, int delta);
+  void rebuildIndex();
+
   Record privateRecordBasedNamedWithExtensions(const char * baseName, int baseNameLength, const char * const extensions[], size_t numberOfExtensions, const char * * extensionResult = nullptr);
   bool recordNameHasBaseNameAndOneOfTheseExtensions(Record::Name name, const char * baseName, int baseNameLength, const char * const extensions[], size_t numberOfExtensions, const char * * extensionResult);
 
@@ -158,6 +194,18 @@ private:
   RecordNameVerifier m_recordNameVerifier;
   mutable Record m_lastRecordRetrieved;
   mutable char * m_lastRecordRetrievedPointer;
+  mutable uint32_t m_numberOfChanges;
+  uint32_t m_indexedCRC32[k_maxNumberOfIndexedRecords];
+  record_size_t m_indexedOffset[k_maxNumberOfIndexedRecords];
+  ExtensionCount m_extensionCounts[k_maxNumberOfCountedExtensions];
+  int m_numberOfIndexedRecords;
+  int m_numberOfCountedExtensions;
+  bool m_indexIsComplete;
+  /* recordWithExtensionAtIndex resumes from the last record it returned when
+   * asked for the next one */
+  uint32_t m_lastExtensionAtIndexCRC32;
+  int m_lastExtensionAtIndex;
+  mutable char * m_lastExtensionAtIndexPointer;
 };
 
 }
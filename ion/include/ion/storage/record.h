@@ -23,6 +23,7 @@ constexpr static char matExtension[] = "mat";
  *   Keeping a buffer with the fullNames will waste memory as we cannot
  *   forsee the size of the fullNames. */
 class Record {
+friend class FileSystem;
 public:
   constexpr static char k_dotChar = '.';
   enum class ErrorStatus {
@@ -18,6 +18,10 @@ class StorageDelegate {
 public:
   virtual void storageDidChangeForRecord(const Record record) = 0;
   virtual void storageIsFull() = 0;
+  /* Some records only cache data that can be computed again. When a record
+   * does not fit, the delegate can destroy them, except recordToKeep, and
+   * return true for the storage to try again. */
+  virtual bool storageCanFreeSpace(const Record recordToKeep) = 0;
 };
 
 }
@@ -1,6 +1,8 @@
+#include <ion/console.h>
 #include <ion/events.h>
 #include <ion/timing.h>
 #include <ion/display.h>
+#include <kandinsky/ion_context.h>
 #include "../../../poincare/include/poincare/print_int.h"
 #include <assert.h>
 
@@ -14,7 +16,7 @@ public:
     return Scenario(name, events, N);
   }
   const char * name() const { return m_name; }
-  const int numberOfEvents() const { return m_numberOfEvents; }
+  constexpr int numberOfEvents() const { return m_numberOfEvents; }
   const Event eventAtIndex(int index) const { return m_events[index]; }
 
   private:
@@ -57,14 +59,120 @@ static constexpr Scenario scenarios[] = {
 
 constexpr static int numberOfScenari = sizeof(scenarios)/sizeof(Scenario);
 
+constexpr static int maxNumberOfEvents() {
+  int max = 0;
+  for (int i = 0; i < numberOfScenari; i++) {
+    max = scenarios[i].numberOfEvents() > max ? scenarios[i].numberOfEvents() : max;
+  }
+  return max;
+}
+
+/* Each event is measured from the moment it is returned to the next call to
+ * getEvent, which covers both its dispatch and the redraw it triggers. The
+ * number of pixels pushed to the display during that time is recorded too. */
+struct Measures {
+  uint32_t values[maxNumberOfEvents()];
+  int numberOfValues;
+};
+
+struct Statistics {
+  uint32_t total;
+  uint32_t median;
+  uint32_t percentile95;
+  uint32_t max;
+};
+
+static Statistics computeStatistics(Measures * measures) {
+  // Insertion sort, there are only a few dozen events per scenario
+  uint32_t * values = measures->values;
+  int n = measures->numberOfValues;
+  uint32_t total = 0;
+  for (int i = 0; i < n; i++) {
+    total += values[i];
+    uint32_t value = values[i];
+    int j = i;
+    while (j > 0 && values[j-1] > value) {
+      values[j] = values[j-1];
+      j--;
+    }
+    values[j] = value;
+  }
+  if (n == 0) {
+    return {0, 0, 0, 0};
+  }
+  // Nearest-rank percentiles
+  return {total, values[(50*n + 99)/100 - 1], values[(95*n + 99)/100 - 1], values[n-1]};
+}
+
+class LineBuffer {
+public:
+  LineBuffer() : m_length(0) { m_buffer[0] = 0; }
+  LineBuffer & append(const char * text) {
+    while (*text != 0 && m_length < k_bufferLength - 1) {
+      m_buffer[m_length++] = *text++;
+    }
+    m_buffer[m_length] = 0;
+    return *this;
+  }
+  LineBuffer & append(uint32_t integer) {
+    m_length += Poincare::PrintInt::Left(integer, m_buffer + m_length, k_bufferLength - 1 - m_length);
+    m_buffer[m_length] = 0;
+    return *this;
+  }
+  const char * text() const { return m_buffer; }
+private:
+  constexpr static int k_bufferLength = 128;
+  char m_buffer[k_bufferLength];
+  int m_length;
+};
+
+/* Results are written on the console as CSV lines:
+ *   event,<scenario>,<index>,<event id>,<ms>,<pixels>
+ *   scenario,<scenario>,<total ms>,<p50 ms>,<p95 ms>,<max ms>,<p50 pixels>,<p95 pixels>,<max pixels> */
+static void logEvent(const Scenario & scenario, int index, uint32_t duration, uint32_t pixels) {
+  LineBuffer line;
+  line.append("event,").append(scenario.name()).append(",").append(index).append(",").append(static_cast<uint8_t>(scenario.eventAtIndex(index))).append(",").append(duration).append(",").append(pixels);
+  Ion::Console::writeLine(line.text());
+}
+
+static void logScenario(const Scenario & scenario, Statistics durations, Statistics pixels) {
+  LineBuffer line;
+  line.append("scenario,").append(scenario.name()).append(",").append(durations.total).append(",").append(durations.median).append(",").append(durations.percentile95).append(",").append(durations.max).append(",").append(pixels.median).append(",").append(pixels.percentile95).append(",").append(pixels.max);
+  Ion::Console::writeLine(line.text());
+}
+
 Event getEvent(int * timeout) {
   static int scenarioIndex = 0;
   static int eventIndex = 0;
   static uint64_t startTime = Ion::Timing::millis();
-  static int timings[numberOfScenari];
+  static uint64_t eventStartTime = startTime;
+  static uint32_t eventStartPixels = KDIonContext::sharedContext()->numberOfPushedPixels();
+  static Measures durations;
+  static Measures pixels;
+  static Statistics durationStatistics[numberOfScenari];
+  static Statistics pixelStatistics[numberOfScenari];
+  if (eventIndex > 0) {
+    // Record the event returned by the previous call
+    uint64_t now = Ion::Timing::millis();
+    uint32_t pushedPixels = KDIonContext::sharedContext()->numberOfPushedPixels();
+    durations.values[durations.numberOfValues++] = now - eventStartTime;
+    pixels.values[pixels.numberOfValues++] = pushedPixels - eventStartPixels;
+  }
   if (eventIndex >= scenarios[scenarioIndex].numberOfEvents()) {
-    timings[scenarioIndex++] = Ion::Timing::millis() - startTime;
+    uint64_t duration = Ion::Timing::millis() - startTime;
+    // Logging happens between scenarios so that it is not measured
+    const Scenario & scenario = scenarios[scenarioIndex];
+    for (int i = 0; i < durations.numberOfValues; i++) {
+      logEvent(scenario, i, durations.values[i], pixels.values[i]);
+    }
+    durationStatistics[scenarioIndex] = computeStatistics(&durations);
+    durationStatistics[scenarioIndex].total = duration;
+    pixelStatistics[scenarioIndex] = computeStatistics(&pixels);
+    logScenario(scenario, durationStatistics[scenarioIndex], pixelStatistics[scenarioIndex]);
+    scenarioIndex++;
     eventIndex = 0;
+    durations.numberOfValues = 0;
+    pixels.numberOfValues = 0;
     startTime = Ion::Timing::millis();
   }
   if (scenarioIndex >= numberOfScenari) {
@@ -74,20 +182,22 @@ Event getEvent(int * timeout) {
     ctx->setOrigin(KDPointZero);
     ctx->setClippingRect(KDRect(0,0,Ion::Display::Width,Ion::Display::Height));
     ctx->fillRect(KDRect(0,0,Ion::Display::Width,Ion::Display::Height), KDColorWhite);
-    const KDFont * font = KDFont::LargeFont;
+    const KDFont * font = KDFont::SmallFont;
     int line_height = font->glyphSize().height();
+    ctx->drawString("ms: total p50 p95 max", KDPoint(0, line_y), font);
+    line_y += line_height;
     for (int i = 0; i < numberOfScenari; i++) {
-      constexpr int bufferLength = 50;
-      char buffer[bufferLength];
-      Poincare::PrintInt::Left(timings[i], buffer, bufferLength);
-      //buffer[50-1-3] = 0; // convert from ms to s without generating _udivmoddi4 (long long division)
+      LineBuffer line;
+      line.append(durationStatistics[i].total).append(" ").append(durationStatistics[i].median).append(" ").append(durationStatistics[i].percentile95).append(" ").append(durationStatistics[i].max);
       ctx->drawString(scenarios[i].name(), KDPoint(0, line_y), font);
-      ctx->drawString(buffer, KDPoint(200, line_y), font);
+      ctx->drawString(line.text(), KDPoint(150, line_y), font);
       line_y += line_height;
     }
     while (1) {
     }
   }
+  eventStartTime = Ion::Timing::millis();
+  eventStartPixels = KDIonContext::sharedContext()->numberOfPushedPixels();
   return scenarios[scenarioIndex].eventAtIndex(eventIndex++);
 }
 
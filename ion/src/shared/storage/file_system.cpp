@@ -58,6 +58,7 @@ size_t FileSystem::putAvailableSpaceAtEndOfRecord(Record r) {
   memmove(nextRecord + availableStorageSize,
       nextRecord,
       (m_buffer + k_storageSize - availableStorageSize) - nextRecord);
+  indexRecordsMoved(nextRecord, availableStorageSize);
   size_t newRecordSize = previousRecordSize + availableStorageSize;
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
   return newRecordSize;
@@ -70,6 +71,7 @@ void FileSystem::getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailab
   memmove(nextRecord - recordAvailableSpace,
       nextRecord,
       m_buffer + k_storageSize - nextRecord);
+  indexRecordsMoved(nextRecord, -recordAvailableSpace);
   overrideSizeAtPosition(p, (record_size_t)(previousRecordSize - recordAvailableSpace));
 }
 
@@ -77,9 +79,16 @@ uint32_t FileSystem::checksum() {
   return Ion::crc32Byte((const uint8_t *) m_buffer, endBuffer()-m_buffer);
 }
 
+void FileSystem::reloadAfterExternalChange() {
+  rebuildIndex();
+  notifyChangeToDelegate();
+}
+
 void FileSystem::notifyChangeToDelegate(const Record record) const {
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
+  m_lastExtensionAtIndexPointer = nullptr;
+  m_numberOfChanges++;
   if (m_delegate != nullptr) {
     m_delegate->storageDidChangeForRecord(record);
   }
@@ -138,6 +147,15 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(Record::Name recordNa
     /* If there is an other record with the same name, it will be either
      * destroyed or this new record won't be created. So we only need the
      * difference of size between the two of available space. */
+    /* Destroying records moves the rest of the buffer, so the name and the
+     * data must not lie in it. */
+    bool canDestroyRecords = recordSize < k_maxRecordSize && !isInBuffer(recordName.baseName);
+    for (size_t i=0; i<numberOfChunks; i++) {
+      canDestroyRecords = canDestroyRecords && !isInBuffer(dataChunks[i]);
+    }
+    if (canDestroyRecords && freeSpaceFromDelegate()) {
+      return createRecordWithDataChunks(recordName, dataChunks, sizeChunks, numberOfChunks, extensionCanOverrideItself);
+    }
    return notifyFullnessToDelegate();
   }
 
@@ -163,6 +181,7 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(Record::Name recordNa
   }
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
+  indexRecord(newRecordAddress);
   Record r = Record(recordName);
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
@@ -172,6 +191,10 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(Record::Name recordNa
 
 
 int FileSystem::numberOfRecordsWithFilter(const char * extension, RecordFilter filter, const void * auxiliary) {
+  if (filter == ExtensionOnlyFilter && m_indexIsComplete) {
+    ExtensionCount * extensionCounter = extensionCount(extension);
+    return extensionCounter == nullptr ? 0 : extensionCounter->numberOfRecords;
+  }
   int count = 0;
   for (char * p : *this) {
     Record::Name currentName = nameOfRecordStarting(p);
@@ -184,10 +207,24 @@ int FileSystem::numberOfRecordsWithFilter(const char * extension, RecordFilter f
 }
 
 Record FileSystem::recordWithFilterAtIndex(const char * extension, int index, RecordFilter filter, const void * auxiliary) {
+  uint32_t extensionCRC32 = 0;
   int currentIndex = -1;
+  RecordIterator iterator = begin();
+  if (filter == ExtensionOnlyFilter) {
+    if (m_indexIsComplete && index >= numberOfRecordsWithFilter(extension, filter)) {
+      return Record();
+    }
+    // Resume from the last record found, when iterating over the records
+    extensionCRC32 = ExtensionCRC32(extension);
+    if (m_lastExtensionAtIndexPointer != nullptr && m_lastExtensionAtIndexCRC32 == extensionCRC32 && m_lastExtensionAtIndex <= index) {
+      currentIndex = m_lastExtensionAtIndex - 1;
+      iterator = RecordIterator(m_lastExtensionAtIndexPointer);
+    }
+  }
   Record::Name name = Record::EmptyName();
   char * recordAddress = nullptr;
-  for (char * p : *this) {
+  for (; iterator != end(); ++iterator) {
+    char * p = *iterator;
     Record::Name currentName = nameOfRecordStarting(p);
     assert(currentName.extension);
     if (!Record::NameIsEmpty(currentName) && filter(currentName, auxiliary) &&  strcmp(currentName.extension, extension) == 0) {
@@ -202,6 +239,11 @@ Record FileSystem::recordWithFilterAtIndex(const char * extension, int index, Re
   if (Record::NameIsEmpty(name)) {
     return Record();
   }
+  if (filter == ExtensionOnlyFilter) {
+    m_lastExtensionAtIndexCRC32 = extensionCRC32;
+    m_lastExtensionAtIndex = index;
+    m_lastExtensionAtIndexPointer = recordAddress;
+  }
   Record r = Record(name);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = recordAddress;
@@ -232,6 +274,7 @@ const char * FileSystem::extensionOfRecordBaseNamedWithExtensions(const char * b
 
 void FileSystem::destroyAllRecords() {
   overrideSizeAtPosition(m_buffer, 0);
+  rebuildIndex();
   notifyChangeToDelegate();
 }
 
@@ -253,6 +296,10 @@ void FileSystem::destroyRecordsWithExtension(const char * extension) {
   }
 }
 
+bool FileSystem::freeSpaceFromDelegate(const Record recordToKeep) {
+  return m_delegate != nullptr && m_delegate->storageCanFreeSpace(recordToKeep);
+}
+
 bool FileSystem::handleCompetingRecord(Record::Name recordName, bool destroyRecordWithSameFullName) {
   Record sameNameRecord = Record(recordName);
   if (isNameOfRecordTaken(sameNameRecord)) {
@@ -284,7 +331,14 @@ FileSystem::FileSystem() :
   m_magicFooter(Magic),
   m_delegate(nullptr),
   m_lastRecordRetrieved(nullptr),
-  m_lastRecordRetrievedPointer(nullptr)
+  m_lastRecordRetrievedPointer(nullptr),
+  m_numberOfChanges(0),
+  m_numberOfIndexedRecords(0),
+  m_numberOfCountedExtensions(0),
+  m_indexIsComplete(true),
+  m_lastExtensionAtIndexCRC32(0),
+  m_lastExtensionAtIndex(-1),
+  m_lastExtensionAtIndexPointer(nullptr)
 {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
@@ -321,12 +375,19 @@ Record::ErrorStatus FileSystem::setNameOfRecord(Record * record, Record::Name na
     size_t previousNameSize = Record::SizeOfName(nameOfRecordStarting(p));
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     size_t newRecordSize = previousRecordSize-previousNameSize+nameSize;
+    // The previous name may be overwritten when the buffer slides
+    unindexRecord(p);
     if (newRecordSize >= k_maxRecordSize || !slideBuffer(p+sizeof(record_size_t)+previousNameSize, nameSize-previousNameSize)) {
+      indexRecord(p);
+      if (newRecordSize < k_maxRecordSize && !isInBuffer(name.baseName) && freeSpaceFromDelegate(oldRecord)) {
+        return setNameOfRecord(record, name);
+      }
       return notifyFullnessToDelegate();
     }
     overrideSizeAtPosition(p, newRecordSize);
     char * namePosition = p + sizeof(record_size_t);
     overrideNameAtPosition(namePosition, name);
+    indexRecord(p);
     // Recompute the CRC32
     *record = newRecord;
     notifyChangeToDelegate(newRecord);
@@ -358,6 +419,9 @@ Record::ErrorStatus FileSystem::setValueOfRecord(Record record, Record::Data dat
     Record::Name name = nameOfRecordStarting(p);
     size_t newRecordSize = sizeOfRecordWithName(name, data.size);
     if (newRecordSize >= k_maxRecordSize || !slideBuffer(p+previousRecordSize, newRecordSize-previousRecordSize)) {
+      if (newRecordSize < k_maxRecordSize && !isInBuffer(data.buffer) && freeSpaceFromDelegate(record)) {
+        return setValueOfRecord(record, data);
+      }
       return notifyFullnessToDelegate();
     }
     record_size_t nameSize = Record::SizeOfName(name);
@@ -378,7 +442,12 @@ void FileSystem::destroyRecord(Record record) {
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
+    unindexRecord(p);
     slideBuffer(p+previousRecordSize, -previousRecordSize);
+    if (!m_indexIsComplete) {
+      // Some records may fit in the index now
+      rebuildIndex();
+    }
     notifyChangeToDelegate();
   }
 }
@@ -391,15 +460,20 @@ char * FileSystem::pointerOfRecord(const Record record) const {
     assert(m_lastRecordRetrievedPointer != nullptr);
     return m_lastRecordRetrievedPointer;
   }
-  for (char * p : *this) {
-    Record currentRecord(nameOfRecordStarting(p));
-    if (record == currentRecord) {
-      m_lastRecordRetrieved = record;
-      m_lastRecordRetrievedPointer = p;
-      return p;
+  char * p = indexedPointerOfRecord(record);
+  if (p == nullptr && !m_indexIsComplete) {
+    for (char * q : *this) {
+      if (record == Record(nameOfRecordStarting(q))) {
+        p = q;
+        break;
+      }
     }
   }
-  return nullptr;
+  if (p != nullptr) {
+    m_lastRecordRetrieved = record;
+    m_lastRecordRetrievedPointer = p;
+  }
+  return p;
 }
 
 FileSystem::record_size_t FileSystem::sizeOfRecordStarting(char * start) const {
@@ -456,16 +530,10 @@ bool FileSystem::isNameOfRecordTaken(Record r, const Record * recordToExclude) {
      * name is nullptr. */
     return true;
   }
-  for (char * p : *this) {
-    Record s(nameOfRecordStarting(p));
-    if (recordToExclude && s == *recordToExclude) {
-      continue;
-    }
-    if (s == r) {
-      return true;
-    }
+  if (recordToExclude && r == *recordToExclude) {
+    return false;
   }
-  return false;
+  return pointerOfRecord(r) != nullptr;
 }
 
 char * FileSystem::endBuffer() {
@@ -485,6 +553,7 @@ bool FileSystem::slideBuffer(char * position, int delta) {
     return false;
   }
   memmove(position+delta, position, endBuffer()+sizeof(record_size_t)-position);
+  indexRecordsMoved(position, delta);
   return true;
 }
 
@@ -493,6 +562,23 @@ Record FileSystem::privateRecordBasedNamedWithExtensions(const char * baseName,
   if (m_lastRecordRetrievedPointer != nullptr && recordNameHasBaseNameAndOneOfTheseExtensions(lastRetrievedRecordName, baseName, baseNameLength, extensions, numberOfExtensions, extensionResult)) {
     return m_lastRecordRetrieved;
   }
+  if (m_indexIsComplete) {
+    /* Look each full name up in the index and keep the first record in the
+     * buffer, as walking the buffer would. */
+    char * recordStart = nullptr;
+    const char * extension = nullptr;
+    for (size_t i = 0; i < numberOfExtensions; i++) {
+      char * p = indexedPointerOfRecord(Record(Record::Name({baseName, static_cast<size_t>(baseNameLength), extensions[i]})));
+      if (p != nullptr && (recordStart == nullptr || p < recordStart)) {
+        recordStart = p;
+        extension = extensions[i];
+      }
+    }
+    if (extensionResult != nullptr) {
+      *extensionResult = extension;
+    }
+    return recordStart == nullptr ? Record() : Record(nameOfRecordStarting(recordStart));
+  }
   for (char * p : *this) {
     Record::Name currentName = nameOfRecordStarting(p);
     if (recordNameHasBaseNameAndOneOfTheseExtensions(currentName, baseName, baseNameLength, extensions, numberOfExtensions, extensionResult)) {
@@ -520,6 +606,124 @@ bool FileSystem::recordNameHasBaseNameAndOneOfTheseExtensions(Record::Name name,
   return false;
 }
 
+uint32_t FileSystem::ExtensionCRC32(const char * extension) {
+  return Ion::crc32Byte((const uint8_t *)extension, strlen(extension));
+}
+
+int FileSystem::indexPositionOfCRC32(uint32_t crc32) const {
+  int lower = 0;
+  int upper = m_numberOfIndexedRecords;
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (m_indexedCRC32[middle] < crc32) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  return lower;
+}
+
+char * FileSystem::indexedPointerOfRecord(const Record record) const {
+  int position = indexPositionOfCRC32(record.m_fullNameCRC32);
+  if (position == m_numberOfIndexedRecords || m_indexedCRC32[position] != record.m_fullNameCRC32) {
+    return nullptr;
+  }
+  char * p = (char *)m_buffer + m_indexedOffset[position];
+  assert(Record(nameOfRecordStarting(p)) == record);
+  return p;
+}
+
+FileSystem::ExtensionCount * FileSystem::extensionCount(const char * extension, bool createIfMissing) {
+  uint32_t extensionCRC32 = ExtensionCRC32(extension);
+  ExtensionCount * emptyCount = nullptr;
+  for (int i = 0; i < m_numberOfCountedExtensions; i++) {
+    if (m_extensionCounts[i].extensionCRC32 == extensionCRC32) {
+      return m_extensionCounts + i;
+    }
+    if (m_extensionCounts[i].numberOfRecords == 0) {
+      emptyCount = m_extensionCounts + i;
+    }
+  }
+  if (!createIfMissing) {
+    return nullptr;
+  }
+  if (emptyCount == nullptr) {
+    if (m_numberOfCountedExtensions == k_maxNumberOfCountedExtensions) {
+      return nullptr;
+    }
+    emptyCount = m_extensionCounts + m_numberOfCountedExtensions++;
+  }
+  emptyCount->extensionCRC32 = extensionCRC32;
+  emptyCount->numberOfRecords = 0;
+  return emptyCount;
+}
+
+void FileSystem::indexRecord(char * recordStart) {
+  Record::Name name = nameOfRecordStarting(recordStart);
+  uint32_t crc32 = Record(name).m_fullNameCRC32;
+  if (m_numberOfIndexedRecords < k_maxNumberOfIndexedRecords) {
+    int position = indexPositionOfCRC32(crc32);
+    assert(position == m_numberOfIndexedRecords || m_indexedCRC32[position] != crc32);
+    int numberOfMovedEntries = m_numberOfIndexedRecords - position;
+    memmove(m_indexedCRC32 + position + 1, m_indexedCRC32 + position, numberOfMovedEntries * sizeof(uint32_t));
+    memmove(m_indexedOffset + position + 1, m_indexedOffset + position, numberOfMovedEntries * sizeof(record_size_t));
+    m_indexedCRC32[position] = crc32;
+    m_indexedOffset[position] = recordStart - m_buffer;
+    m_numberOfIndexedRecords++;
+  } else {
+    m_indexIsComplete = false;
+  }
+  ExtensionCount * extensionCounter = extensionCount(name.extension, true);
+  if (extensionCounter != nullptr) {
+    extensionCounter->numberOfRecords++;
+  } else {
+    m_indexIsComplete = false;
+  }
+}
+
+void FileSystem::unindexRecord(char * recordStart) {
+  Record::Name name = nameOfRecordStarting(recordStart);
+  uint32_t crc32 = Record(name).m_fullNameCRC32;
+  int position = indexPositionOfCRC32(crc32);
+  if (position < m_numberOfIndexedRecords && m_indexedCRC32[position] == crc32) {
+    int numberOfMovedEntries = m_numberOfIndexedRecords - position - 1;
+    memmove(m_indexedCRC32 + position, m_indexedCRC32 + position + 1, numberOfMovedEntries * sizeof(uint32_t));
+    memmove(m_indexedOffset + position, m_indexedOffset + position + 1, numberOfMovedEntries * sizeof(record_size_t));
+    m_numberOfIndexedRecords--;
+  } else {
+    assert(!m_indexIsComplete);
+  }
+  ExtensionCount * extensionCounter = extensionCount(name.extension);
+  // Counts are only exact if the index is complete
+  assert(!m_indexIsComplete || (extensionCounter != nullptr && extensionCounter->numberOfRecords > 0));
+  if (extensionCounter != nullptr && extensionCounter->numberOfRecords > 0) {
+    extensionCounter->numberOfRecords--;
+  }
+}
+
+void FileSystem::indexRecordsMoved(char * position, int delta) {
+  m_numberOfChanges++;
+  record_size_t offset = position - m_buffer;
+  for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+    if (m_indexedOffset[i] >= offset) {
+      m_indexedOffset[i] += delta;
+    }
+  }
+  if (m_lastExtensionAtIndexPointer != nullptr && m_lastExtensionAtIndexPointer >= position) {
+    m_lastExtensionAtIndexPointer += delta;
+  }
+}
+
+void FileSystem::rebuildIndex() {
+  m_numberOfIndexedRecords = 0;
+  m_numberOfCountedExtensions = 0;
+  m_indexIsComplete = true;
+  for (char * p : *this) {
+    indexRecord(p);
+  }
+}
+
 FileSystem::RecordIterator & FileSystem::RecordIterator::operator++() {
   assert(m_recordStart);
   record_size_t size = StorageHelper::unalignedShort(m_recordStart);
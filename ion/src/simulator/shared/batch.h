@@ -0,0 +1,24 @@
+#ifndef ION_SIMULATOR_BATCH_H
+#define ION_SIMULATOR_BATCH_H
+
+namespace Ion {
+namespace Simulator {
+namespace Batch {
+
+/* Replay all the state files (.nws) of stateFilesDirectory in up to
+ * numberOfJobs worker processes at once. numberOfJobs defaults to the number
+ * of available cores when it is not positive.
+ *
+ * Workers are forked from the calling process: in a worker, run returns true
+ * and sets stateFile and screenshotPath (which is nullptr if
+ * screenshotsDirectory is) to the scenario to replay. In the calling process,
+ * run waits for all the workers, prints the duration of each scenario and
+ * returns false, numberOfFailures being set to the number of workers that did
+ * not exit successfully. */
+bool run(const char * stateFilesDirectory, const char * screenshotsDirectory, int numberOfJobs, const char ** stateFile, const char ** screenshotPath, int * numberOfFailures);
+
+}
+}
+}
+
+#endif
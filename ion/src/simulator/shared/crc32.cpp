@@ -1,8 +1,59 @@
 #include <ion.h>
-#include <ion/src/shared/crc32_eat_byte.h>
+#include <assert.h>
+#include <string.h>
 
 namespace Ion {
 
+/* This computes the same CRC32 as the CRC unit of the device: polynomial
+ * 0x04C11DB7, most significant bit first, initial value 0xFFFFFFFF.
+ * Instead of processing one bit at a time, words are processed eight bytes at
+ * a time ("slicing-by-8"): m_tables[n][b] is the CRC of byte b followed by n
+ * null bytes, so that the CRC of 8 bytes is the XOR of 8 table lookups. */
+
+class CRC32Tables {
+public:
+  constexpr static int k_numberOfTables = 8;
+  constexpr CRC32Tables() : m_tables() {
+    constexpr uint32_t polynomial = 0x04C11DB7;
+    for (uint32_t b = 0; b < 256; b++) {
+      uint32_t crc = b << 24;
+      for (int i = 0; i < 8; i++) {
+        crc = crc & 0x80000000 ? ((crc << 1) ^ polynomial) : (crc << 1);
+      }
+      m_tables[0][b] = crc;
+    }
+    for (int n = 1; n < k_numberOfTables; n++) {
+      for (int b = 0; b < 256; b++) {
+        uint32_t previous = m_tables[n-1][b];
+        m_tables[n][b] = (previous << 8) ^ m_tables[0][previous >> 24];
+      }
+    }
+  }
+  uint32_t eatByte(uint32_t crc, uint8_t data) const {
+    return (crc << 8) ^ m_tables[0][(crc >> 24) ^ data];
+  }
+  uint32_t eatWord(uint32_t crc, uint32_t word) const {
+    crc ^= word;
+    return m_tables[3][crc >> 24] ^ m_tables[2][(crc >> 16) & 0xFF] ^ m_tables[1][(crc >> 8) & 0xFF] ^ m_tables[0][crc & 0xFF];
+  }
+  uint32_t eatTwoWords(uint32_t crc, uint32_t firstWord, uint32_t secondWord) const {
+    crc ^= firstWord;
+    return m_tables[7][crc >> 24] ^ m_tables[6][(crc >> 16) & 0xFF] ^ m_tables[5][(crc >> 8) & 0xFF] ^ m_tables[4][crc & 0xFF]
+      ^ m_tables[3][secondWord >> 24] ^ m_tables[2][(secondWord >> 16) & 0xFF] ^ m_tables[1][(secondWord >> 8) & 0xFF] ^ m_tables[0][secondWord & 0xFF];
+  }
+private:
+  uint32_t m_tables[k_numberOfTables][256];
+};
+
+static constexpr CRC32Tables sTables;
+
+static uint32_t loadWord(const uint8_t * data) {
+  // Copy the bytes to avoid alignment issue when building for emscripten platform
+  uint32_t word;
+  memcpy(&word, data, sizeof(uint32_t));
+  return word;
+}
+
 static uint32_t crc32Helper(const uint8_t * data, size_t length, bool wordAccess) {
   if (length == 0) {
     return 0;
@@ -13,15 +64,16 @@ static uint32_t crc32Helper(const uint8_t * data, size_t length, bool wordAccess
   size_t byteLength = (wordAccess ? length * uint32ByteLength : length);
   size_t wordLength = byteLength / uint32ByteLength;
 
-  for (size_t i = 0; i < wordLength; i++) {
-    // FIXME: Assumes little-endian byte order!
-    for (int j = uint32ByteLength-1; j >= 0; j--) {
-      // scan byte by byte to avoid alignment issue when building for emscripten platform
-      crc = crc32EatByte(crc, data[i*uint32ByteLength+j]);
-    }
+  // FIXME: Assumes little-endian byte order!
+  size_t i = 0;
+  for (; i + 1 < wordLength; i += 2) {
+    crc = sTables.eatTwoWords(crc, loadWord(data + i*uint32ByteLength), loadWord(data + (i+1)*uint32ByteLength));
+  }
+  if (i < wordLength) {
+    crc = sTables.eatWord(crc, loadWord(data + i*uint32ByteLength));
   }
-  for (size_t i = wordLength * uint32ByteLength; i < byteLength; i++) {
-    crc = crc32EatByte(crc, data[i]);
+  for (size_t j = wordLength * uint32ByteLength; j < byteLength; j++) {
+    crc = sTables.eatByte(crc, data[j]);
   }
   return crc;
 }
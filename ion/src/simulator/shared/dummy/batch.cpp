@@ -0,0 +1,16 @@
+#include "../batch.h"
+#include <stdio.h>
+
+namespace Ion {
+namespace Simulator {
+namespace Batch {
+
+bool run(const char * stateFilesDirectory, const char * screenshotsDirectory, int numberOfJobs, const char ** stateFile, const char ** screenshotPath, int * numberOfFailures) {
+  fprintf(stderr, "Replaying state files in batch is not supported on this platform\n");
+  *numberOfFailures = 1;
+  return false;
+}
+
+}
+}
+}
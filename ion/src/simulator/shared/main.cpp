@@ -16,7 +16,9 @@
 #if ION_SIMULATOR_FILES
 #include "screenshot.h"
 #include <signal.h>
+#include <stdlib.h>
 #include "actions.h"
+#include "batch.h"
 #endif
 
 /* The Args class allows parsing and editing command-line arguments
@@ -98,6 +100,26 @@ int main(int argc, char * argv[]) {
 #endif
 
 #if ION_SIMULATOR_FILES
+  /* In batch mode, this process only forks workers, each of which carries on
+   * with the headless replay of one state file. */
+  const char * batchDirectory = args.pop("--batch-state-files");
+  const char * batchScreenshotsDirectory = args.pop("--batch-screenshots");
+  const char * batchJobs = args.pop("--batch-jobs");
+  if (batchDirectory) {
+    const char * batchStateFile = nullptr;
+    const char * batchScreenshotPath = nullptr;
+    int numberOfFailures = 0;
+    if (!Batch::run(batchDirectory, batchScreenshotsDirectory, batchJobs ? atoi(batchJobs) : 0, &batchStateFile, &batchScreenshotPath, &numberOfFailures)) {
+      return numberOfFailures > 0;
+    }
+    args.pop("--load-state-file");
+    args.pop("--take-screenshot");
+    args.popFlag("--headless");
+    args.push("--load-state-file", batchStateFile);
+    args.push("--take-screenshot", batchScreenshotPath);
+    args.push("--headless");
+  }
+
   const char * stateFile = args.pop("--load-state-file");
   if (stateFile) {
     assert(Journal::replayJournal());
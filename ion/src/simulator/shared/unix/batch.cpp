@@ -0,0 +1,142 @@
+#include "../batch.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace Ion {
+namespace Simulator {
+namespace Batch {
+
+static constexpr const char * sStateFileExtension = ".nws";
+static constexpr const char * sScreenshotExtension = ".png";
+
+struct Scenario {
+  std::string name;
+  std::string stateFile;
+  std::string screenshot;
+  pid_t pid;
+  double startTime;
+  double duration;
+  int status;
+};
+
+static std::vector<Scenario> sScenarios;
+
+static double milliseconds() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+
+static bool hasStateFileExtension(const char * filename) {
+  size_t length = strlen(filename);
+  size_t extensionLength = strlen(sStateFileExtension);
+  return length > extensionLength && strcmp(filename + length - extensionLength, sStateFileExtension) == 0;
+}
+
+static bool listScenarios(const char * stateFilesDirectory, const char * screenshotsDirectory) {
+  DIR * directory = opendir(stateFilesDirectory);
+  if (directory == nullptr) {
+    fprintf(stderr, "Cannot open state files directory %s\n", stateFilesDirectory);
+    return false;
+  }
+  while (struct dirent * entry = readdir(directory)) {
+    if (!hasStateFileExtension(entry->d_name)) {
+      continue;
+    }
+    Scenario scenario;
+    scenario.name = std::string(entry->d_name, strlen(entry->d_name) - strlen(sStateFileExtension));
+    scenario.stateFile = std::string(stateFilesDirectory) + "/" + entry->d_name;
+    if (screenshotsDirectory) {
+      scenario.screenshot = std::string(screenshotsDirectory) + "/" + scenario.name + sScreenshotExtension;
+    }
+    scenario.pid = -1;
+    scenario.status = -1;
+    sScenarios.push_back(scenario);
+  }
+  closedir(directory);
+  // Keep the report in a stable order
+  std::sort(sScenarios.begin(), sScenarios.end(), [](const Scenario & a, const Scenario & b) { return a.name < b.name; });
+  return true;
+}
+
+static void reportScenario(const Scenario & scenario) {
+  bool success = WIFEXITED(scenario.status) && WEXITSTATUS(scenario.status) == 0;
+  printf("%s\t%s\t%.1f ms\n", scenario.name.c_str(), success ? "OK" : "FAILED", scenario.duration);
+  fflush(stdout);
+}
+
+bool run(const char * stateFilesDirectory, const char * screenshotsDirectory, int numberOfJobs, const char ** stateFile, const char ** screenshotPath, int * numberOfFailures) {
+  *numberOfFailures = 0;
+  if (!listScenarios(stateFilesDirectory, screenshotsDirectory)) {
+    *numberOfFailures = 1;
+    return false;
+  }
+  if (numberOfJobs <= 0) {
+    numberOfJobs = std::max(1L, sysconf(_SC_NPROCESSORS_ONLN));
+  }
+
+  double batchStartTime = milliseconds();
+  int numberOfScenarios = sScenarios.size();
+  int numberOfRunningJobs = 0;
+  int nextScenario = 0;
+  while (nextScenario < numberOfScenarios || numberOfRunningJobs > 0) {
+    if (nextScenario < numberOfScenarios && numberOfRunningJobs < numberOfJobs) {
+      Scenario * scenario = &sScenarios[nextScenario++];
+      // Do not let the workers print the buffered output again
+      fflush(stdout);
+      scenario->startTime = milliseconds();
+      scenario->pid = fork();
+      if (scenario->pid == 0) {
+        // Keep the report readable, errors still go to stderr
+        int devNull = open("/dev/null", O_WRONLY);
+        if (devNull >= 0) {
+          dup2(devNull, STDOUT_FILENO);
+          close(devNull);
+        }
+        *stateFile = scenario->stateFile.c_str();
+        *screenshotPath = screenshotsDirectory ? scenario->screenshot.c_str() : nullptr;
+        return true;
+      }
+      if (scenario->pid < 0) {
+        fprintf(stderr, "Cannot fork a worker for %s\n", scenario->stateFile.c_str());
+        scenario->duration = 0.0;
+        reportScenario(*scenario);
+        (*numberOfFailures)++;
+        continue;
+      }
+      numberOfRunningJobs++;
+      continue;
+    }
+    int status;
+    pid_t pid = wait(&status);
+    if (pid < 0) {
+      break;
+    }
+    for (Scenario & scenario : sScenarios) {
+      if (scenario.pid == pid) {
+        scenario.status = status;
+        scenario.duration = milliseconds() - scenario.startTime;
+        reportScenario(scenario);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+          (*numberOfFailures)++;
+        }
+        break;
+      }
+    }
+    numberOfRunningJobs--;
+  }
+  printf("%d scenarios, %d failures, %d jobs, %.1f ms\n", numberOfScenarios, *numberOfFailures, numberOfJobs, milliseconds() - batchStartTime);
+  return false;
+}
+
+}
+}
+}
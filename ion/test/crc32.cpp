@@ -1,4 +1,5 @@
 #include <quiz.h>
+#include <quiz/stopwatch.h>
 #include <ion.h>
 #include <assert.h>
 
@@ -13,3 +14,57 @@ QUIZ_CASE(ion_crc32) {
   quiz_assert(Ion::crc32Byte(inputBytes, 6) == 0x7BCD4EB3);
   quiz_assert(Ion::crc32Byte(inputBytes, 8) == 0x72EAD3FB);
 }
+
+static uint32_t bitwiseCrc32Byte(const uint8_t * data, size_t length) {
+  if (length == 0) {
+    return 0;
+  }
+  uint32_t crc = 0xFFFFFFFF;
+  size_t wordLength = length / 4;
+  for (size_t i = 0; i < length; i++) {
+    // Bytes of whole words are read from the most significant one
+    size_t index = i < wordLength * 4 ? (i & ~static_cast<size_t>(3)) + 3 - (i & 3) : i;
+    crc ^= data[index] << 24;
+    for (int j = 0; j < 8; j++) {
+      crc = crc & 0x80000000 ? ((crc << 1) ^ 0x04C11DB7) : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+QUIZ_CASE(ion_crc32_lengths_and_alignments) {
+  uint8_t data[64 + 4];
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = 37 * i + 11;
+  }
+  for (size_t offset = 0; offset < 4; offset++) {
+    for (size_t length = 0; length <= 64; length++) {
+      quiz_assert(Ion::crc32Byte(data + offset, length) == bitwiseCrc32Byte(data + offset, length));
+    }
+  }
+}
+
+QUIZ_CASE(ion_crc32_long_buffer) {
+  // A kilobyte chains many steps of the computation, read as bytes or words
+  uint32_t data[256];
+  for (size_t i = 0; i < sizeof(data)/sizeof(uint32_t); i++) {
+    data[i] = 2654435761u * i;
+  }
+  uint32_t crc = bitwiseCrc32Byte(reinterpret_cast<const uint8_t *>(data), sizeof(data));
+  quiz_assert(Ion::crc32Byte(reinterpret_cast<const uint8_t *>(data), sizeof(data)) == crc);
+  quiz_assert(Ion::crc32Word(data, sizeof(data)/sizeof(uint32_t)) == crc);
+}
+
+QUIZ_CASE(ion_crc32_storage_checksum_time) {
+  static uint8_t buffer[Ion::Storage::FileSystem::k_storageSize];
+  for (size_t i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = i ^ (i >> 8);
+  }
+  uint32_t crc = Ion::crc32Byte(buffer, sizeof(buffer));
+  constexpr int k_numberOfChecksums = 100;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < k_numberOfChecksums; i++) {
+    quiz_assert(Ion::crc32Byte(buffer, sizeof(buffer)) == crc);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
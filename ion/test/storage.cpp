@@ -649,3 +649,69 @@ QUIZ_CASE(ion_storage_record_name_verifier) {
   recordNameVerifier->unregisterAllRestrictiveExtensions();
   recordNameVerifier->unregisterAllReservedNames();
 }
+
+QUIZ_CASE(ion_storage_records_index) {
+  Storage::FileSystem * fileSystem = Storage::FileSystem::sharedFileSystem();
+  size_t initialStorageAvailableStage = fileSystem->availableSize();
+  const char * extensions[] = {"idx0", "idx1", "idx2", "idx3", "idx4", "idx5", "idx6", "idx7", "idx8", "idx9"};
+  constexpr int numberOfExtensions = sizeof(extensions)/sizeof(const char *);
+  /* Create more records and extensions than the index holds, so that lookups
+   * also go through the buffer */
+  constexpr int numberOfRecords = 100;
+  for (int i = 0; i < numberOfRecords; i++) {
+    char baseName[] = {'r', static_cast<char>('0' + i / 10), static_cast<char>('0' + i % 10), 0};
+    quiz_assert(putRecordInSharedStorage(baseName, extensions[i % numberOfExtensions], baseName) == Storage::Record::ErrorStatus::None);
+  }
+  quiz_assert(fileSystem->numberOfRecordsWithExtension(extensions[0]) == numberOfRecords / numberOfExtensions);
+
+  // Destroy the records of half of the extensions to fit in the index again
+  for (int i = 0; i < numberOfExtensions; i += 2) {
+    fileSystem->destroyRecordsWithExtension(extensions[i]);
+    quiz_assert(fileSystem->numberOfRecordsWithExtension(extensions[i]) == 0);
+  }
+  quiz_assert(fileSystem->numberOfRecordsWithExtension(extensions[1]) == numberOfRecords / numberOfExtensions);
+  quiz_assert(fileSystem->recordBaseNamedWithExtension("r10", extensions[0]).isNull());
+  Storage::Record r11 = fileSystem->recordBaseNamedWithExtension("r11", extensions[1]);
+  quiz_assert(strncmp(static_cast<const char *>(r11.value().buffer), "r11", 3) == 0);
+
+  // Records found after the buffer slid
+  const char * data = "This record grew, so all the following records moved.";
+  quiz_assert(r11.setValue({.buffer = data, .size = strlen(data) + 1}) == Storage::Record::ErrorStatus::None);
+  Storage::Record r13 = fileSystem->recordBaseNamedWithExtension("r13", extensions[3]);
+  quiz_assert(strncmp(static_cast<const char *>(r13.value().buffer), "r13", 3) == 0);
+  quiz_assert(Storage::Record::SetBaseNameWithExtension(&r13, "renamedRecord", extensions[1]) == Storage::Record::ErrorStatus::None);
+  quiz_assert(fileSystem->recordBaseNamedWithExtension("r13", extensions[3]).isNull());
+  quiz_assert(fileSystem->recordBaseNamedWithExtension("renamedRecord", extensions[1]) == r13);
+  quiz_assert(fileSystem->numberOfRecordsWithExtension(extensions[1]) == numberOfRecords / numberOfExtensions + 1);
+  quiz_assert(fileSystem->numberOfRecordsWithExtension(extensions[3]) == numberOfRecords / numberOfExtensions - 1);
+  quiz_assert(putRecordInSharedStorage("r21", extensions[3], "r21") == Storage::Record::ErrorStatus::None);
+  Storage::Record r15 = fileSystem->recordBaseNamedWithExtension("r15", extensions[5]);
+  quiz_assert(strncmp(static_cast<const char *>(r15.value().buffer), "r15", 3) == 0);
+
+  // The first record in the buffer is found among several extensions
+  const char * lookedUpExtensions[] = {extensions[3], extensions[1]};
+  quiz_assert(strcmp(fileSystem->extensionOfRecordBaseNamedWithExtensions("r21", 3, lookedUpExtensions, 2), extensions[1]) == 0);
+
+  // Records are iterated over in the buffer order
+  int numberOfRecordsWithExtension = fileSystem->numberOfRecordsWithExtension(extensions[1]);
+  for (int i = 0; i < numberOfRecordsWithExtension; i++) {
+    Storage::Record record = fileSystem->recordWithExtensionAtIndex(extensions[1], i);
+    quiz_assert(!record.isNull());
+    if (i > 0) {
+      quiz_assert(record.name().baseName > fileSystem->recordWithExtensionAtIndex(extensions[1], i - 1).name().baseName);
+    }
+  }
+  quiz_assert(fileSystem->recordWithExtensionAtIndex(extensions[1], numberOfRecordsWithExtension).isNull());
+
+  // Records are indexed again after the buffer is written externally
+  uint32_t numberOfChanges = fileSystem->numberOfChanges();
+  fileSystem->reloadAfterExternalChange();
+  quiz_assert(fileSystem->numberOfChanges() != numberOfChanges);
+  quiz_assert(fileSystem->numberOfRecordsWithExtension(extensions[1]) == numberOfRecordsWithExtension);
+  quiz_assert(fileSystem->recordBaseNamedWithExtension("renamedRecord", extensions[1]) == r13);
+
+  for (int i = 1; i < numberOfExtensions; i += 2) {
+    fileSystem->destroyRecordsWithExtension(extensions[i]);
+  }
+  quiz_assert(fileSystem->availableSize() == initialStorageAvailableStage);
+}
@@ -0,0 +1,58 @@
+#ifndef KANDINSKY_GLYPH_CACHE_H
+#define KANDINSKY_GLYPH_CACHE_H
+
+#include <kandinsky/color.h>
+#include <kandinsky/font.h>
+#include <stdint.h>
+
+/* KDGlyphCache keeps the last colorized glyphs drawn by KDContext::drawString,
+ * so that redrawing the same text (table cells, axis labels, the Python
+ * console...) does not decompress and colorize every glyph again.
+ *
+ * Entries are keyed by font, code point, text and background colors, and the
+ * least recently used one is replaced on a miss. ASCII code points of the two
+ * system fonts are found in a direct-indexed table instead of scanning all the
+ * entries. Glyphs followed by combining code points are not cached. */
+
+class KDGlyphCache {
+public:
+  static KDGlyphCache * SharedCache();
+
+  KDGlyphCache() : m_numberOfAccesses(0) { clear(); }
+
+  /* Return the pixels of the glyph of codePoint, colorized with palette which
+   * must be the render palette of textColor and backgroundColor. The pixels
+   * stay valid until the next call. */
+  const KDColor * colorizedGlyph(const KDFont * font, CodePoint codePoint, KDColor textColor, KDColor backgroundColor, const KDFont::RenderPalette * palette);
+  void clear();
+
+private:
+  constexpr static int k_numberOfEntries = 16;
+  constexpr static int k_numberOfASCIICodePoints = 128;
+  constexpr static int k_numberOfIndexedFonts = 2;
+  constexpr static uint8_t k_noEntry = 0xFF;
+  static_assert(k_numberOfEntries < k_noEntry, "Entry indexes must fit in a uint8_t");
+
+  struct Entry {
+    bool isEmpty() const { return font == nullptr; }
+    bool matches(const KDFont * f, CodePoint c, KDColor text, KDColor background) const {
+      return font == f && codePoint == c && textColor == text && backgroundColor == background;
+    }
+    const KDFont * font;
+    uint32_t codePoint;
+    KDColor textColor;
+    KDColor backgroundColor;
+    uint32_t lastAccess;
+    KDFont::GlyphBuffer glyph;
+  };
+
+  // Return the row of m_asciiEntries of font, or -1 if font is not indexed
+  static int IndexedFontIndex(const KDFont * font);
+  uint8_t * asciiEntry(const KDFont * font, CodePoint codePoint);
+
+  Entry m_entries[k_numberOfEntries];
+  uint8_t m_asciiEntries[k_numberOfIndexedFonts][k_numberOfASCIICodePoints];
+  uint32_t m_numberOfAccesses;
+};
+
+#endif
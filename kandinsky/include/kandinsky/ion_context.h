@@ -7,11 +7,14 @@ class KDIonContext : public KDContext {
 public:
   static KDIonContext * sharedContext();
   static void putchar(char c);
+  // Count of pixels pushed to the display, used to benchmark redraws
+  uint32_t numberOfPushedPixels() const { return m_numberOfPushedPixels; }
 private:
   KDIonContext();
   void pushRect(KDRect rect, const KDColor * pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor * pixels) override;
+  uint32_t m_numberOfPushedPixels;
 };
 
 #endif
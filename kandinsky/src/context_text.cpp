@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <kandinsky/context.h>
 #include <kandinsky/font.h>
+#include <kandinsky/glyph_cache.h>
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/display.h>
 #include <cmath>
@@ -68,19 +69,26 @@ KDPoint KDContext::drawString(const char * text, KDPoint p, const KDFont * font,
       codePoint = decoder.nextCodePoint();
     } else {
       assert(!codePoint.isCombining());
-      font->setGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+      CodePoint glyphCodePoint = codePoint;
       codePoint = decoder.nextCodePoint();
-      while (codePoint.isCombining()) {
-        font->accumulateGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
-        codePointPointer = decoder.stringPosition();
-        codePoint = decoder.nextCodePoint();
+      const KDColor * glyphPixels;
+      if (codePoint.isCombining()) {
+        font->setGlyphGrayscalesForCodePoint(glyphCodePoint, &glyphBuffer);
+        while (codePoint.isCombining()) {
+          font->accumulateGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+          codePointPointer = decoder.stringPosition();
+          codePoint = decoder.nextCodePoint();
+        }
+        font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+        glyphPixels = glyphBuffer.colorBuffer();
+      } else {
+        glyphPixels = KDGlyphCache::SharedCache()->colorizedGlyph(font, glyphCodePoint, textColor, backgroundColor, &palette);
       }
-      font->colorizeGlyphBuffer(&palette, &glyphBuffer);
       // Push the character on the screen
       fillRectWithPixels(
           KDRect(position, glyphSize),
-          glyphBuffer.colorBuffer(),
-          glyphBuffer.colorBuffer() // It's OK to trash the content of the color buffer since we'll re-fetch it for the next char anyway
+          glyphPixels,
+          glyphBuffer.colorBuffer() // It's OK to trash the content of the color buffer since cached glyphs are never drawn from it
           );
       position = position.translatedBy(KDPoint(glyphSize.width(), 0));
     }
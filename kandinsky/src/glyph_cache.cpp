@@ -0,0 +1,82 @@
+#include <kandinsky/glyph_cache.h>
+#include <assert.h>
+
+KDGlyphCache * KDGlyphCache::SharedCache() {
+  static KDGlyphCache cache;
+  return &cache;
+}
+
+const KDColor * KDGlyphCache::colorizedGlyph(const KDFont * font, CodePoint codePoint, KDColor textColor, KDColor backgroundColor, const KDFont::RenderPalette * palette) {
+  uint8_t * indexedEntry = asciiEntry(font, codePoint);
+  Entry * entry = nullptr;
+  if (indexedEntry != nullptr && *indexedEntry != k_noEntry
+      && m_entries[*indexedEntry].matches(font, codePoint, textColor, backgroundColor)) {
+    entry = m_entries + *indexedEntry;
+  } else {
+    // The indexed entry may have been drawn with other colors
+    for (int i = 0; i < k_numberOfEntries; i++) {
+      if (m_entries[i].matches(font, codePoint, textColor, backgroundColor)) {
+        entry = m_entries + i;
+        break;
+      }
+    }
+  }
+
+  if (entry == nullptr) {
+    // Replace an empty entry or else the least recently used one
+    entry = m_entries;
+    for (int i = 1; i < k_numberOfEntries && !entry->isEmpty(); i++) {
+      if (m_entries[i].isEmpty() || m_entries[i].lastAccess < entry->lastAccess) {
+        entry = m_entries + i;
+      }
+    }
+    if (!entry->isEmpty()) {
+      uint8_t * evictedIndexedEntry = asciiEntry(entry->font, entry->codePoint);
+      if (evictedIndexedEntry != nullptr && *evictedIndexedEntry == entry - m_entries) {
+        *evictedIndexedEntry = k_noEntry;
+      }
+    }
+    entry->font = font;
+    entry->codePoint = codePoint;
+    entry->textColor = textColor;
+    entry->backgroundColor = backgroundColor;
+    font->setGlyphGrayscalesForCodePoint(codePoint, &entry->glyph);
+    font->colorizeGlyphBuffer(palette, &entry->glyph);
+  }
+
+  if (indexedEntry != nullptr) {
+    *indexedEntry = entry - m_entries;
+  }
+  entry->lastAccess = ++m_numberOfAccesses;
+  return entry->glyph.colorBuffer();
+}
+
+void KDGlyphCache::clear() {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    m_entries[i].font = nullptr;
+  }
+  for (int i = 0; i < k_numberOfIndexedFonts; i++) {
+    for (int j = 0; j < k_numberOfASCIICodePoints; j++) {
+      m_asciiEntries[i][j] = k_noEntry;
+    }
+  }
+}
+
+int KDGlyphCache::IndexedFontIndex(const KDFont * font) {
+  if (font == KDFont::SmallFont) {
+    return 0;
+  }
+  if (font == KDFont::LargeFont) {
+    return 1;
+  }
+  return -1;
+}
+
+uint8_t * KDGlyphCache::asciiEntry(const KDFont * font, CodePoint codePoint) {
+  int fontIndex = IndexedFontIndex(font);
+  if (fontIndex < 0 || codePoint >= k_numberOfASCIICodePoints) {
+    return nullptr;
+  }
+  assert(fontIndex < k_numberOfIndexedFonts);
+  return &m_asciiEntries[fontIndex][codePoint];
+}
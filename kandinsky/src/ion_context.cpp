@@ -8,15 +8,18 @@ KDIonContext * KDIonContext::sharedContext() {
 
 KDIonContext::KDIonContext() :
 KDContext(KDPointZero,
-    KDRect(0, 0, Ion::Display::Width, Ion::Display::Height))
+    KDRect(0, 0, Ion::Display::Width, Ion::Display::Height)),
+  m_numberOfPushedPixels(0)
 {
 }
 
 void KDIonContext::pushRect(KDRect rect, const KDColor * pixels) {
+  m_numberOfPushedPixels += rect.width() * rect.height();
   Ion::Display::pushRect(rect, pixels);
 }
 
 void KDIonContext::pushRectUniform(KDRect rect, KDColor color) {
+  m_numberOfPushedPixels += rect.width() * rect.height();
   Ion::Display::pushRectUniform(rect, color);
 }
 
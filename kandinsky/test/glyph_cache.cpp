@@ -0,0 +1,46 @@
+#include <kandinsky/glyph_cache.h>
+#include <quiz.h>
+
+void assert_glyph_is_colorized(const KDFont * font, CodePoint codePoint, KDColor textColor, KDColor backgroundColor) {
+  KDFont::RenderPalette palette = font->renderPalette(textColor, backgroundColor);
+  const KDColor * cachedGlyph = KDGlyphCache::SharedCache()->colorizedGlyph(font, codePoint, textColor, backgroundColor, &palette);
+  KDFont::GlyphBuffer glyphBuffer;
+  font->setGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+  font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+  int numberOfPixels = font->glyphSize().width() * font->glyphSize().height();
+  for (int i = 0; i < numberOfPixels; i++) {
+    quiz_assert(cachedGlyph[i] == glyphBuffer.colorBuffer()[i]);
+  }
+}
+
+QUIZ_CASE(kandinsky_glyph_cache_hits) {
+  KDGlyphCache * cache = KDGlyphCache::SharedCache();
+  cache->clear();
+  KDFont::RenderPalette palette = KDFont::LargeFont->renderPalette(KDColorBlack, KDColorWhite);
+  const KDColor * glyph = cache->colorizedGlyph(KDFont::LargeFont, 'a', KDColorBlack, KDColorWhite, &palette);
+  quiz_assert(cache->colorizedGlyph(KDFont::LargeFont, 'a', KDColorBlack, KDColorWhite, &palette) == glyph);
+  // Other fonts, code points and colors are distinct entries
+  quiz_assert(cache->colorizedGlyph(KDFont::SmallFont, 'a', KDColorBlack, KDColorWhite, &palette) != glyph);
+  quiz_assert(cache->colorizedGlyph(KDFont::LargeFont, 'b', KDColorBlack, KDColorWhite, &palette) != glyph);
+  KDFont::RenderPalette redPalette = KDFont::LargeFont->renderPalette(KDColorRed, KDColorWhite);
+  quiz_assert(cache->colorizedGlyph(KDFont::LargeFont, 'a', KDColorRed, KDColorWhite, &redPalette) != glyph);
+  quiz_assert(cache->colorizedGlyph(KDFont::LargeFont, 'a', KDColorBlack, KDColorWhite, &palette) == glyph);
+}
+
+QUIZ_CASE(kandinsky_glyph_cache_pixels) {
+  KDGlyphCache::SharedCache()->clear();
+  const KDFont * fonts[] = {KDFont::SmallFont, KDFont::LargeFont};
+  const KDColor colors[][2] = {{KDColorBlack, KDColorWhite}, {KDColorWhite, KDColorRed}};
+  // Non-ASCII code points are not indexed
+  const CodePoint codePoints[] = {'0', 'x', '~', UCodePointGreekSmallLetterPi, UCodePointIntegral, UCodePointReplacement};
+  // Cycle through more glyphs than the cache holds to evict entries
+  for (int repetition = 0; repetition < 3; repetition++) {
+    for (const KDFont * font : fonts) {
+      for (const KDColor * colorPair : colors) {
+        for (CodePoint c : codePoints) {
+          assert_glyph_is_colorized(font, c, colorPair[0], colorPair[1]);
+        }
+      }
+    }
+  }
+}
@@ -3,6 +3,7 @@
 
 #include <poincare/approximation_helper.h>
 #include <poincare/expression.h>
+#include <poincare/integer.h>
 
 namespace Poincare {
 
@@ -43,7 +44,8 @@ public:
   // Expression
   Expression shallowReduce(const ExpressionNode::ReductionContext& reductionContext);
 private:
-  constexpr static int k_maxNValue = 300;
+  // The limit grows with the largest Integer, binomial(n, n/2) < 2^n
+  constexpr static int k_maxNValue = 300 * Integer::k_maxNumberOfDigits / 32;
 };
 
 }
@@ -0,0 +1,99 @@
+#ifndef POINCARE_COMPILED_EXPRESSION_H
+#define POINCARE_COMPILED_EXPRESSION_H
+
+#include <poincare/expression.h>
+#include <poincare/preferences.h>
+#include <complex>
+#include <stdint.h>
+
+/* A CompiledExpression is a flat postfix program lowered from a reduced scalar
+ * expression of one variable. It holds no reference to the TreePool, so that
+ * approximating it for many values of the variable (when plotting a curve for
+ * instance) does not walk the expression tree nor build any Evaluation.
+ *
+ * Only the real complex format and a subset of node types are handled. Any
+ * constant subtree is approximated once at compilation. At evaluation, the
+ * program only handles finite real intermediate values, mimicking the
+ * computeOnComplex methods of the nodes it replaces. Whenever an intermediate
+ * value is not finite, it gives up and the caller is expected to approximate
+ * the expression tree instead. This way, both approximations always match. */
+
+namespace Poincare {
+
+class CompiledExpression {
+public:
+  constexpr static int k_maxBatchSize = 16;
+
+  CompiledExpression() : m_numberOfInstructions(0), m_numberOfConstants(0), m_angleUnit(Preferences::AngleUnit::Radian) {}
+
+  /* Return false if e cannot be compiled, in which case the compiled
+   * expression is left empty. */
+  bool compile(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  void clear() { m_numberOfInstructions = 0; m_numberOfConstants = 0; }
+  bool isCompiled() const { return m_numberOfInstructions > 0; }
+
+  /* Return false if the result could differ from the approximation of the
+   * expression tree. result is then left untouched. */
+  template<typename T> bool approximateWithValueForSymbol(T x, T * result) const;
+  /* Approximate the expression for n values of the variable at once, n being
+   * at most k_maxBatchSize. handled[i] is false if results[i] could differ
+   * from the approximation of the expression tree. */
+  template<typename T> void approximateWithValuesForSymbol(const T * x, T * results, bool * handled, int n) const;
+
+private:
+  constexpr static int k_maxNumberOfInstructions = 32;
+  constexpr static int k_maxNumberOfConstants = 12;
+  constexpr static int k_maxStackDepth = 12;
+
+  enum class OpCode : uint8_t {
+    Constant,
+    Variable,
+    Pop,
+    Addition,
+    Multiplication,
+    Power,
+    /* RationalPower's operand is the index of p, q being the next constant.
+     * It reproduces the real root of c^(p/q) used in real complex format. */
+    RationalPower,
+    Sine,
+    Cosine,
+    Tangent,
+    /* Reduced logarithms keep their base as a second child. Logarithm's
+     * operand is the index of the common logarithm of this base. */
+    Logarithm,
+    AbsoluteValue,
+  };
+
+  struct Instruction {
+    OpCode opCode;
+    uint8_t operand;
+  };
+
+  enum class Status : uint8_t {
+    Real,
+    Nonreal,
+    Unhandled
+  };
+
+  template<typename T> static Status RealPart(std::complex<T> c, T * result);
+  template<typename T> static Status PowerOnReals(T c, T d, T * result);
+  template<typename T> T constantAtIndex(int i) const;
+
+  static bool IsConstant(const Expression e, Context * context);
+  bool compileNode(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, int * stackDepth);
+  bool pushInstruction(OpCode opCode, uint8_t operand = 0);
+  // Return the index of the added constant, or -1 if there is no room left
+  int addConstant(float floatValue, double doubleValue);
+  bool pushConstant(float floatValue, double doubleValue);
+
+  Instruction m_instructions[k_maxNumberOfInstructions];
+  float m_floatConstants[k_maxNumberOfConstants];
+  double m_doubleConstants[k_maxNumberOfConstants];
+  uint8_t m_numberOfInstructions;
+  uint8_t m_numberOfConstants;
+  Preferences::AngleUnit m_angleUnit;
+};
+
+}
+
+#endif
@@ -66,6 +66,11 @@ public:
 
 protected:
   Evaluation(EvaluationNode<T> * n) : TreeHandle(n) {}
+  /* Add the complexes after the last child. When the evaluation is the last
+   * tree of the pool, the new children are built in place and nothing is
+   * moved, so that building a list or a matrix this way is linear in its
+   * number of children. */
+  void appendComplexesInPlace(const std::complex<T> * complexes, int numberOfComplexes);
 };
 
 }
@@ -3,6 +3,7 @@
 
 #include <poincare/approximation_helper.h>
 #include <poincare/expression.h>
+#include <poincare/integer.h>
 
 namespace Poincare {
 
@@ -54,7 +55,8 @@ public:
   using ExpressionBuilder::ExpressionBuilder;
   Expression shallowReduce(const ExpressionNode::ReductionContext& reductionContext);
 private:
-  constexpr static int k_maxOperandValue = 100;
+  // 100! has 158 base 10 digits, the limit grows with the largest Integer
+  constexpr static int k_maxOperandValue = 100 * Integer::k_maxNumberOfDigits / 32;
 };
 
 }
@@ -15,6 +15,10 @@ size_t AlignedSize(size_t realSize, size_t alignment);
 size_t Gcd(size_t a, size_t b);
 bool Rotate(uint32_t * dst, uint32_t * src, size_t len);
 void Sort(Swap swap, Compare compare, void * context, int numberOfElements);
+/* Sort values in ascending order without going through Swap and Compare
+ * callbacks. NaN are put at the end if nanIsGreatest, at the start otherwise. */
+template <typename T>
+void Sort(T * values, int numberOfElements, bool nanIsGreatest = true);
 int ExtremumIndex(Compare compare, void * context, int numberOfElements, bool minimum);
 bool FloatIsGreater(float xI, float xJ, bool nanIsGreatest);
 
@@ -6,6 +6,12 @@
 #include <limits.h>
 #include <poincare/horizontal_layout.h>
 
+/* The largest integers can be raised at build time (see poincare/Makefile) on
+ * platforms that can afford it. The device keeps the default size. */
+#ifndef POINCARE_INTEGER_MAX_NUMBER_OF_DIGITS
+#define POINCARE_INTEGER_MAX_NUMBER_OF_DIGITS 32
+#endif
+
 namespace Poincare {
 
 class ExpressionLayout;
@@ -161,9 +167,13 @@ public:
   static Expression CreateMixedFraction(const Integer & num, const Integer & denom);
   static Expression CreateEuclideanDivision(const Integer & num, const Integer & denom);
 
-  constexpr static int k_maxNumberOfDigits = 32;
+  constexpr static int k_maxNumberOfDigits = POINCARE_INTEGER_MAX_NUMBER_OF_DIGITS;
+  /* Numbers of digits are stored on uint8_t, including a temporary overflow
+   * digit and the carry digit of additions. */
+  static_assert(k_maxNumberOfDigits + 2 <= UINT8_MAX, "Integer digits cannot be counted on uint8_t");
 private:
-  constexpr static int k_maxNumberOfDigitsBase10 = 309; // 1E308 < (2^32)^k_maxNumberOfDigits < 1E309
+  // log10(2) ~ 0.30103, so that 1E308 < (2^32)^32 < 1E309
+  constexpr static int k_maxNumberOfDigitsBase10 = (k_maxNumberOfDigits * 32 * 30103) / 100000 + 1;
   constexpr static int k_maxNumberOfParsedDigitsBase10 = 30; // the screen is 30 digits large.
   constexpr static int k_maxExtractableInteger = INT_MAX;
 
@@ -15,6 +15,7 @@ template<typename T>
 class ListComplexNode final : public EvaluationNode<T> {
 public:
   std::complex<T> complexAtIndex(int index) const override;
+  void complexesAtIndexes(int startIndex, int numberOfComplexes, std::complex<T> * complexes) const;
   int numberOfChildren() const override {
     return m_numberOfChildren < 0 ? 0 : m_numberOfChildren;
   }
@@ -45,6 +46,7 @@ public:
   Expression complexToExpression(Preferences::Preferences::ComplexFormat complexFormat) const override;
 
 private:
+  static std::complex<T> ComplexOfChild(const EvaluationNode<T> * child);
   int16_t m_numberOfChildren;
 
 };
@@ -63,8 +65,17 @@ public:
   std::complex<T> complexAtIndex(int index) const {
     return node()->complexAtIndex(index);
   }
+  /* Reaching a child walks through all the previous ones: read consecutive
+   * complexes with a single walk instead of calling complexAtIndex on each. */
+  void complexesAtIndexes(int startIndex, int numberOfComplexes, std::complex<T> * complexes) const {
+    node()->complexesAtIndexes(startIndex, numberOfComplexes, complexes);
+  }
 
   void addChildAtIndexInPlace(Evaluation<T> t, int index, int currentNumberOfChildren);
+  void appendComplexes(const std::complex<T> * complexes, int numberOfComplexes) {
+    assert(!node()->isUndefined());
+    Evaluation<T>::appendComplexesInPlace(complexes, numberOfComplexes);
+  }
 
   // Helper function
   ListComplex<T> sort();
@@ -68,6 +68,12 @@ public:
   Expression createTrace();
   // Inverse the array in-place. Array has to be given in the form array[row_index][column_index]
   template<typename T> static int ArrayInverse(T * array, int numberOfRows, int numberOfColumns);
+  /* Multiply the arrays in result, which must not be one of them. Arrays are
+   * given in the form array[row_index][column_index]. */
+  template<typename T> static void ArrayMultiply(const T * array1, const T * array2, T * result, int numberOfRows1, int numberOfColumns1, int numberOfColumns2);
+  /* Raise the square array to a non-negative integer power in-place. Negative
+   * powers are computed by inverting the array first with ArrayInverse. */
+  template<typename T> static void ArrayPower(T * array, int dim, int power);
   static Matrix CreateIdentity(int dim);
   Matrix createTranspose() const;
   Expression createRef(const ExpressionNode::ReductionContext& reductionContext, bool * couldComputeRef, bool reduced) const;
@@ -19,6 +19,12 @@ public:
   {}
 
   std::complex<T> complexAtIndex(int index) const override;
+  // Copy all the complexes, in row-major order, with a single walk
+  void copyComplexes(std::complex<T> * operands) const;
+  /* Multiply on the right by the row-major array operands, into result. The
+   * coefficients are read with a single walk, in the order ArrayMultiply
+   * would use them, so that they do not have to be copied first. */
+  void multiplyComplexes(const std::complex<T> * operands, int numberOfColumns, std::complex<T> * result) const;
 
   // TreeNode
   size_t size() const override { return sizeof(MatrixComplexNode<T>); }
@@ -56,7 +62,7 @@ class MatrixComplex final : public Evaluation<T> {
 public:
   MatrixComplex(MatrixComplexNode<T> * node) : Evaluation<T>(node) {}
   static MatrixComplex Builder() { return TreeHandle::NAryBuilder<MatrixComplex<T>, MatrixComplexNode<T>>(); }
-  static MatrixComplex Builder(std::complex<T> * operands, int numberOfRows, int numberOfColumns);
+  static MatrixComplex Builder(const std::complex<T> * operands, int numberOfRows, int numberOfColumns);
   static MatrixComplex<T> Undefined();
   static MatrixComplex<T> CreateIdentity(int dim);
   std::complex<T> trace() const { return node()->trace(); }
@@ -70,6 +76,8 @@ public:
   std::complex<T> complexAtIndex(int index) const {
     return node()->complexAtIndex(index);
   }
+  void copyComplexes(std::complex<T> * operands) const { node()->copyComplexes(operands); }
+  void multiplyComplexes(const std::complex<T> * operands, int numberOfColumns, std::complex<T> * result) const { node()->multiplyComplexes(operands, numberOfColumns, result); }
   Array::VectorType vectorType() const { return node()->vectorType(); }
   int numberOfRows() const { return node()->numberOfRows(); }
   int numberOfColumns() const { return node()->numberOfColumns(); }
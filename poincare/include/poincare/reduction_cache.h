@@ -0,0 +1,81 @@
+#ifndef POINCARE_REDUCTION_CACHE_H
+#define POINCARE_REDUCTION_CACHE_H
+
+#include <poincare/expression.h>
+#include <stdint.h>
+
+/* The ReductionCache memoizes Expression::cloneAndDeepReduceWithSystemCheckpoint
+ * for expressions that do not depend on the context, i.e. expressions without
+ * symbols, functions, sequences, stores nor random nodes.
+ *
+ * Entries live outside of the TreePool: both the input tree and its reduced
+ * form are copied byte for byte in a static buffer, like trees are copied
+ * within the pool, and are copied back into the pool on a hit. An entry is
+ * looked up by a structural hash of the input and by the reduction context it
+ * was reduced with. As hashes can collide, a hit is only confirmed once the
+ * input has been compared to its copy. The simplification order ignoring some
+ * node data (such as matrix dimensions), the serializations of the inputs
+ * are compared as well.
+ *
+ * Reduction also depends on the exam mode, which forbids some functions: the
+ * cache is cleared whenever the exam mode changes. Reductions that only
+ * succeeded once retried with another target are not cached, as the retry
+ * depends on how full the pool was. */
+
+namespace Poincare {
+
+class ReductionCache {
+public:
+  static ReductionCache * SharedCache();
+
+  ReductionCache() : m_numberOfAccesses(0) { clear(); }
+
+  // Return an uninitialized expression if e is not cached
+  Expression reducedExpression(const Expression e, const ExpressionNode::ReductionContext & reductionContext);
+  void storeReducedExpression(const Expression e, const ExpressionNode::ReductionContext & reductionContext, const Expression reduced);
+  void clear();
+
+  static bool IsCacheable(const Expression e, Context * context);
+
+private:
+  constexpr static int k_numberOfEntries = 4;
+  constexpr static int k_entryBufferSize = 512;
+  constexpr static int k_maxSerializationLength = 128;
+
+  struct Key {
+    bool operator==(const Key & other) const;
+    uint32_t hash;
+    Preferences::ComplexFormat complexFormat;
+    Preferences::AngleUnit angleUnit;
+    Preferences::UnitFormat unitFormat;
+    ExpressionNode::ReductionTarget target;
+    ExpressionNode::SymbolicComputation symbolicComputation;
+    ExpressionNode::UnitConversion unitConversion;
+  };
+
+  struct Entry {
+    bool isEmpty() const { return inputSize == 0; }
+    Key key;
+    /* The reduced tree is stored right after the input tree in buffer,
+     * followed by the serialization of the input. */
+    uint16_t inputSize;
+    uint16_t reducedSize;
+    uint16_t serializationLength;
+    uint32_t lastAccess;
+    AlignedNodeBuffer buffer[k_entryBufferSize/ByteAlignment];
+  };
+
+  static uint32_t Hash(const Expression e, uint32_t hash);
+  static uint32_t Hash(const char * text, int length, uint32_t hash);
+  /* Return the length of the serialization of e written in buffer, or -1 if
+   * it does not fit. */
+  static int Serialize(const Expression e, char * buffer);
+  static Key KeyForExpression(const Expression e, const char * serialization, int serializationLength, const ExpressionNode::ReductionContext & reductionContext);
+
+  Entry m_entries[k_numberOfEntries];
+  uint32_t m_numberOfAccesses;
+};
+
+}
+
+#endif
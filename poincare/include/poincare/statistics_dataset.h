@@ -42,7 +42,7 @@ class StatisticsDataset {
 public:
   static StatisticsDataset<T> BuildFromChildren(const ExpressionNode * e, const ExpressionNode::ApproximationContext& approximationContext, ListComplex<T> evaluationArray[]);
 
-  StatisticsDataset(const DatasetColumn<T> * values, const DatasetColumn<T> * weights) : m_values(values), m_weights(weights), m_sortedIndex(FloatList<float>::Builder()), m_recomputeSortedIndex(true), m_memoizedTotalWeight(NAN), m_lnOfValues(false) {}
+  StatisticsDataset(const DatasetColumn<T> * values, const DatasetColumn<T> * weights) : m_values(values), m_weights(weights), m_sortedIndex(), m_recomputeSortedIndex(true), m_memoizedTotalWeight(NAN), m_lnOfValues(false) {}
   StatisticsDataset(const DatasetColumn<T> * values) : StatisticsDataset(values, nullptr) {}
   StatisticsDataset() : StatisticsDataset(nullptr, nullptr) {}
 
@@ -51,7 +51,7 @@ public:
   void setHasBeenModified() { m_recomputeSortedIndex = true; m_memoizedTotalWeight = NAN; }
   int indexAtSortedIndex(int i) const;
 
-  void setLnOfValues(bool b) { m_lnOfValues = b; }
+  void setLnOfValues(bool b) { m_lnOfValues = b; setHasBeenModified(); }
 
   T totalWeight() const;
   T weightedSum() const;
@@ -87,11 +87,19 @@ private:
   T weightAtIndex(int index) const;
   T privateTotalWeight() const;
   void buildSortedIndex() const;
+  bool hasNativeSortedIndex() const { return datasetLength() <= k_maxNumberOfNativeSortedIndexes; }
+
+  /* Sorted indexes fit in a byte for datasets of up to 256 elements, which
+   * covers the datasets of the apps. They are then stored natively instead of
+   * in the pool, which saves node lookups and float conversions. */
+  constexpr static int k_maxNumberOfNativeSortedIndexes = UINT8_MAX + 1;
 
   const DatasetColumn<T> * m_values;
   const DatasetColumn<T> * m_weights;
-  /* This is just a list of int, but FloatList is the most optimized class for
-   * containing numbers in the pool.*/
+  mutable uint8_t m_nativeSortedIndex[k_maxNumberOfNativeSortedIndexes];
+  /* Sorted indexes of longer datasets. This is just a list of int, but
+   * FloatList is the most optimized class for containing numbers in the
+   * pool.*/
   mutable FloatList<float> m_sortedIndex;
   mutable bool m_recomputeSortedIndex;
   mutable double m_memoizedTotalWeight;
@@ -6,10 +6,17 @@
 #include <stddef.h>
 #include <string.h>
 #include <new>
+#include <type_traits>
 #if POINCARE_TREE_LOG
 #include <iostream>
 #endif
 
+/* The pool capacity can be raised at build time (see poincare/Makefile) on
+ * platforms that can afford it. The device keeps the default size. */
+#ifndef POINCARE_TREE_POOL_BUFFER_SIZE
+#define POINCARE_TREE_POOL_BUFFER_SIZE 32768
+#endif
+
 namespace Poincare {
 
 class TreeHandle;
@@ -39,7 +46,7 @@ public:
   // Node
   TreeNode * node(uint16_t identifier) const {
     assert(TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes);
-    if (m_nodeForIdentifierOffset[identifier] != UINT16_MAX) {
+    if (m_nodeForIdentifierOffset[identifier] != k_noNodeOffset) {
       return const_cast<TreeNode *>(reinterpret_cast<const TreeNode *>(m_alignedBuffer + m_nodeForIdentifierOffset[identifier]));
     }
     return nullptr;
@@ -64,9 +71,17 @@ public:
   int numberOfNodes() const;
 
 private:
-  constexpr static int BufferSize = 32768;
+  constexpr static int BufferSize = POINCARE_TREE_POOL_BUFFER_SIZE;
+  static_assert(BufferSize % ByteAlignment == 0, "The tree pool size must be a multiple of the node alignment");
+  /* A node being at least sizeof(TreeNode) large, the buffer is always full
+   * before identifiers run out. As identifiers are stored on 16 bits in nodes
+   * and handles, this bounds the size of larger pools. */
   constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode);
   constexpr static int k_maxNodeOffset = BufferSize/ByteAlignment;
+  /* Node offsets are only widened when they cannot fit on 16 bits, so that the
+   * default pool keeps its compact identifier table. */
+  typedef std::conditional<(k_maxNodeOffset < UINT16_MAX), uint16_t, uint32_t>::type NodeOffset;
+  constexpr static NodeOffset k_noNodeOffset = static_cast<NodeOffset>(-1);
 
   static TreePool * SharedStaticPool;
 #ifndef NDEBUG
@@ -141,7 +156,7 @@ private:
     void push(uint16_t i);
     uint16_t pop();
     void remove(uint16_t j);
-    void resetNodeForIdentifierOffsets(uint16_t * nodeForIdentifierOffset) const;
+    void resetNodeForIdentifierOffsets(NodeOffset * nodeForIdentifierOffset) const;
   private:
     uint16_t m_currentIndex;
     uint16_t m_availableIdentifiers[MaxNumberOfNodes];
@@ -155,9 +170,9 @@ private:
   AlignedNodeBuffer m_alignedBuffer[BufferSize/ByteAlignment];
   char * m_cursor;
   IdentifierStack m_identifiers;
-  uint16_t m_nodeForIdentifierOffset[MaxNumberOfNodes];
-  static_assert(k_maxNodeOffset < UINT16_MAX && sizeof(m_nodeForIdentifierOffset[0]) == sizeof(uint16_t),
-        "The tree pool node offsets in m_nodeForIdentifierOffset cannot be written with the chosen data size (uint16_t)");
+  NodeOffset m_nodeForIdentifierOffset[MaxNumberOfNodes];
+  static_assert(k_maxNodeOffset < k_noNodeOffset,
+        "The tree pool node offsets in m_nodeForIdentifierOffset cannot be written with the chosen data size");
 };
 
 }
@@ -19,8 +19,14 @@ public:
   static constexpr float k_mediumUnitMantissa = 2.f;
   static constexpr float k_largeUnitMantissa = 5.f;
   static constexpr float k_minimalRangeLength = 1e-4f;
+  // Maximal number of abscissas given at once to a ValuesAtAbscissas
+  static constexpr int k_evaluationBatchSize = 16;
 
   typedef SolverHelper<float>::ValueAtAbscissa ValueAtAbscissa;
+  /* Optional batch counterpart of a ValueAtAbscissa, which should return the
+   * same values. It is used by the sampling methods to evaluate up to
+   * k_evaluationBatchSize abscissas at once. */
+  typedef void (*ValuesAtAbscissas)(const float * x, float * y, int n, Context * context, const void * auxiliary);
 
   /* The following convention is taken for returned ranges :
    * - min < max : the range is valid.
@@ -35,10 +41,10 @@ public:
   static void InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, float tMin, float tMax, Context * context, const void * auxiliary);
   /* Find the best Y range to display the function on [xMin, xMax], but crop
    * the values that are outside of the function's order of magnitude. */
-  static void RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float xMin, float xMax, float * yMin, float * yMax, Context * context, const void * auxiliary);
-  static void FullRange(ValueAtAbscissa evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary);
-  static void RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float xMin, float xMax, float yMinForced, float yMaxForced, float * yMin, float * yMax, Context * context, const void * auxiliary);
-  static void ExpandSparseWindow(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary);
+  static void RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float xMin, float xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation = nullptr);
+  static void FullRange(ValueAtAbscissa evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation = nullptr);
+  static void RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float xMin, float xMax, float yMinForced, float yMaxForced, float * yMin, float * yMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation = nullptr);
+  static void ExpandSparseWindow(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation = nullptr);
 
   /* Find the bounding box of two given ranges. */
   static void CombineRanges(float min1, float max1, float min2, float max2, float * minRes, float * maxRes);
@@ -78,6 +84,8 @@ private:
    * the slope should taper off toward the center. */
   static bool IsConvexAroundExtremum(ValueAtAbscissa evaluation, float x1, float x2, float x3, float y1, float y2, float y3, Context * context, const void * auxiliary, int iterations = 7);
   static bool DoesNotOverestimatePrecision(float dx, float y1, float y2, float y3);
+  // Evaluate n <= k_evaluationBatchSize abscissas, with batchEvaluation if any
+  static void EvaluateAtAbscissas(ValueAtAbscissa evaluation, ValuesAtAbscissas batchEvaluation, const float * x, float * y, int n, Context * context, const void * auxiliary);
 };
 
 }
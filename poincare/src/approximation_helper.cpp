@@ -4,6 +4,7 @@
 #include <poincare/float.h>
 #include <poincare/list_complex.h>
 #include <poincare/matrix_complex.h>
+#include <algorithm>
 #include <cmath>
 #include <float.h>
 #include <stdint.h>
@@ -79,21 +80,30 @@ template <typename T> std::complex<T> ApproximationHelper::NeglectRealOrImaginar
   return result;
 }
 
+/* Lists are read and built by chunks of complexes held in arrays: reaching a
+ * child of a list walks through all the previous ones, so accessing them one by
+ * one would make element-wise operations quadratic in the length of the list. */
+constexpr static int k_listChunkLength = 16;
+
 template<typename T> ListComplex<T> ElementWiseOnListAndComplex(const ListComplex<T> l, const std::complex<T> c, Preferences::ComplexFormat complexFormat, ApproximationHelper::ComplexAndComplexReduction<T> computeOnComplexes, bool complexFirst) {
   if (l.isUndefined()) {
     return ListComplex<T>::Undefined();
   }
   ListComplex<T> result = ListComplex<T>::Builder();
   int nChildren = l.numberOfChildren();
-  for (int i = 0; i < nChildren; i++) {
-    std::complex<T> complexAtIndex = l.complexAtIndex(i);
-    Evaluation<T> computedNewComplex;
-    if (complexFirst) {
-      computedNewComplex = computeOnComplexes(c, complexAtIndex, complexFormat);
-    } else {
-      computedNewComplex = computeOnComplexes(complexAtIndex, c, complexFormat);
+  std::complex<T> listComplexes[k_listChunkLength];
+  std::complex<T> resultComplexes[k_listChunkLength];
+  for (int start = 0; start < nChildren; start += k_listChunkLength) {
+    int chunkLength = std::min(k_listChunkLength, nChildren - start);
+    l.complexesAtIndexes(start, chunkLength, listComplexes);
+    for (int i = 0; i < chunkLength; i++) {
+      if (complexFirst) {
+        resultComplexes[i] = computeOnComplexes(c, listComplexes[i], complexFormat).complexAtIndex(0);
+      } else {
+        resultComplexes[i] = computeOnComplexes(listComplexes[i], c, complexFormat).complexAtIndex(0);
+      }
     }
-    result.addChildAtIndexInPlace(computedNewComplex, i, i);
+    result.appendComplexes(resultComplexes, chunkLength);
   }
   return result;
 }
@@ -104,14 +114,53 @@ template<typename T> ListComplex<T> ElementWiseOnLists(const ListComplex<T> l1,
   }
   ListComplex<T> result = ListComplex<T>::Builder();
   int nChildren = l1.numberOfChildren();
-  for (int i = 0; i < nChildren; i++) {
-    result.addChildAtIndexInPlace(computeOnComplexes(l1.complexAtIndex(i), l2.complexAtIndex(i), complexFormat), i, i);
+  std::complex<T> list1Complexes[k_listChunkLength];
+  std::complex<T> list2Complexes[k_listChunkLength];
+  std::complex<T> resultComplexes[k_listChunkLength];
+  for (int start = 0; start < nChildren; start += k_listChunkLength) {
+    int chunkLength = std::min(k_listChunkLength, nChildren - start);
+    l1.complexesAtIndexes(start, chunkLength, list1Complexes);
+    l2.complexesAtIndexes(start, chunkLength, list2Complexes);
+    for (int i = 0; i < chunkLength; i++) {
+      resultComplexes[i] = computeOnComplexes(list1Complexes[i], list2Complexes[i], complexFormat).complexAtIndex(0);
+    }
+    result.appendComplexes(resultComplexes, chunkLength);
   }
   return result;
 }
 
 constexpr static int k_maxNumberOfParametersForMap = 4;
 
+/* The chunks are kept out of Map's frame, which stays on the stack while the
+ * children are approximated. */
+template<typename T> static ListComplex<T> MapOnLists(const Evaluation<T> * evaluationArray, int numberOfParameters, int listLength, const ExpressionNode::ApproximationContext& approximationContext, ApproximationHelper::ComplexesCompute<T> compute, void * context) {
+  std::complex<T> parametersComplexes[k_maxNumberOfParametersForMap][k_listChunkLength];
+  std::complex<T> resultComplexes[k_listChunkLength];
+  std::complex<T> complexesArray[k_maxNumberOfParametersForMap];
+  ListComplex<T> resultList = ListComplex<T>::Builder();
+  for (int start = 0; start < listLength; start += k_listChunkLength) {
+    int chunkLength = std::min(k_listChunkLength, listLength - start);
+    for (int i = 0; i < numberOfParameters; i++) {
+      if (evaluationArray[i].type() == EvaluationNode<T>::Type::ListComplex) {
+        static_cast<const ListComplex<T> &>(evaluationArray[i]).complexesAtIndexes(start, chunkLength, parametersComplexes[i]);
+      }
+    }
+    for (int k = 0; k < chunkLength; k++) {
+      for (int i = 0; i < numberOfParameters; i++) {
+        if (evaluationArray[i].type() == EvaluationNode<T>::Type::Complex) {
+          complexesArray[i] = evaluationArray[i].complexAtIndex(0);
+        } else {
+          assert(evaluationArray[i].type() == EvaluationNode<T>::Type::ListComplex);
+          complexesArray[i] = parametersComplexes[i][k];
+        }
+      }
+      resultComplexes[k] = compute(complexesArray, numberOfParameters, approximationContext.complexFormat(), approximationContext.angleUnit(), context).complexAtIndex(0);
+    }
+    resultList.appendComplexes(resultComplexes, chunkLength);
+  }
+  return resultList;
+}
+
 template<typename T> Evaluation<T> ApproximationHelper::Map(const ExpressionNode * expression, const ExpressionNode::ApproximationContext& approximationContext, ComplexesCompute<T> compute, bool mapOnList, void * context) {
 
   Evaluation<T> evaluationArray[k_maxNumberOfParametersForMap];
@@ -139,27 +188,15 @@ template<typename T> Evaluation<T> ApproximationHelper::Map(const ExpressionNode
     }
   }
 
-  std::complex<T> complexesArray[k_maxNumberOfParametersForMap];
   if (listLength == Expression::k_noList) {
+    std::complex<T> complexesArray[k_maxNumberOfParametersForMap];
     for (int i = 0; i < numberOfParameters; i++) {
       assert(evaluationArray[i].type() == EvaluationNode<T>::Type::Complex);
       complexesArray[i] = evaluationArray[i].complexAtIndex(0);
     }
     return compute(complexesArray, numberOfParameters, approximationContext.complexFormat(), approximationContext.angleUnit(), context);
   }
-  ListComplex<T> resultList = ListComplex<T>::Builder();
-  for (int k = 0; k < listLength; k++) {
-    for (int i = 0; i < numberOfParameters; i++) {
-      if (evaluationArray[i].type() == EvaluationNode<T>::Type::Complex) {
-        complexesArray[i] = evaluationArray[i].complexAtIndex(0);
-      } else {
-        assert(evaluationArray[i].type() == EvaluationNode<T>::Type::ListComplex);
-        complexesArray[i] = evaluationArray[i].complexAtIndex(k);
-      }
-    }
-    resultList.addChildAtIndexInPlace(compute(complexesArray, numberOfParameters, approximationContext.complexFormat(), approximationContext.angleUnit(), context), k, k);
-  }
-  return std::move(resultList);
+  return MapOnLists<T>(evaluationArray, numberOfParameters, listLength, approximationContext, compute, context);
 }
 
 template<typename T> Evaluation<T> ApproximationHelper::MapOneChild(const ExpressionNode * expression, const ExpressionNode::ApproximationContext& approximationContext, ComplexCompute<T> compute, bool mapOnList) {
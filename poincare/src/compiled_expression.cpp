@@ -0,0 +1,397 @@
+#include <poincare/compiled_expression.h>
+#include <poincare/approximation_helper.h>
+#include <poincare/dependency.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+#include <poincare/trigonometry.h>
+#include <assert.h>
+#include <cmath>
+#include <string.h>
+
+namespace Poincare {
+
+constexpr int CompiledExpression::k_maxBatchSize;
+constexpr int CompiledExpression::k_maxNumberOfInstructions;
+constexpr int CompiledExpression::k_maxNumberOfConstants;
+constexpr int CompiledExpression::k_maxStackDepth;
+
+bool CompiledExpression::compile(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  clear();
+  m_angleUnit = angleUnit;
+  /* In other complex formats, intermediate complex values can still yield a
+   * real result: they cannot be handled by a program working on reals. */
+  if (e.isUninitialized() || complexFormat != Preferences::ComplexFormat::Real) {
+    return false;
+  }
+  int stackDepth = 0;
+  Expression expression = e;
+  if (e.type() == ExpressionNode::Type::Dependency) {
+    /* Dependencies only matter if they are undefined or nonreal. The program
+     * evaluates and discards them, giving up on any undefined value. */
+    Expression dependencies = e.childAtIndex(Dependency::k_indexOfDependenciesList);
+    if (dependencies.type() != ExpressionNode::Type::List) {
+      return false;
+    }
+    int numberOfDependencies = dependencies.numberOfChildren();
+    for (int i = 0; i < numberOfDependencies; i++) {
+      if (!compileNode(dependencies.childAtIndex(i), symbol, context, complexFormat, &stackDepth) || !pushInstruction(OpCode::Pop)) {
+        clear();
+        return false;
+      }
+      stackDepth--;
+    }
+    expression = e.childAtIndex(0);
+  }
+  if (!compileNode(expression, symbol, context, complexFormat, &stackDepth)) {
+    clear();
+    return false;
+  }
+  assert(stackDepth == 1);
+  return true;
+}
+
+template<typename T>
+bool CompiledExpression::approximateWithValueForSymbol(T x, T * result) const {
+  bool handled;
+  approximateWithValuesForSymbol(&x, result, &handled, 1);
+  return handled;
+}
+
+template<typename T>
+void CompiledExpression::approximateWithValuesForSymbol(const T * x, T * results, bool * handled, int n) const {
+  assert(isCompiled());
+  assert(0 < n && n <= k_maxBatchSize);
+  /* Each instruction is applied to the whole batch before the next one, so
+   * that the dispatch happens once per instruction and the arithmetic runs in
+   * plain loops over contiguous values. A sample stops being tracked as soon
+   * as its status is no longer Real, as the scalar evaluation would have
+   * stopped there. */
+  T stack[k_maxStackDepth][k_maxBatchSize];
+  Status statuses[k_maxBatchSize];
+  for (int j = 0; j < n; j++) {
+    statuses[j] = std::isfinite(x[j]) ? Status::Real : Status::Unhandled;
+  }
+  int stackDepth = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    const Instruction instruction = m_instructions[i];
+    switch (instruction.opCode) {
+    case OpCode::Constant:
+    {
+      T c = constantAtIndex<T>(instruction.operand);
+      T * top = stack[stackDepth++];
+      for (int j = 0; j < n; j++) {
+        top[j] = c;
+      }
+      continue;
+    }
+    case OpCode::Variable:
+    {
+      T * top = stack[stackDepth++];
+      for (int j = 0; j < n; j++) {
+        top[j] = x[j];
+      }
+      continue;
+    }
+    case OpCode::Pop:
+      stackDepth--;
+      continue;
+    case OpCode::Addition:
+    {
+      stackDepth--;
+      T * top = stack[stackDepth - 1];
+      const T * operand = stack[stackDepth];
+      for (int j = 0; j < n; j++) {
+        top[j] += operand[j];
+      }
+      break;
+    }
+    case OpCode::Multiplication:
+    {
+      stackDepth--;
+      T * top = stack[stackDepth - 1];
+      const T * operand = stack[stackDepth];
+      for (int j = 0; j < n; j++) {
+        top[j] *= operand[j];
+      }
+      break;
+    }
+    case OpCode::Power:
+    {
+      stackDepth--;
+      T * top = stack[stackDepth - 1];
+      const T * operand = stack[stackDepth];
+      for (int j = 0; j < n; j++) {
+        if (statuses[j] == Status::Real) {
+          statuses[j] = PowerOnReals(top[j], operand[j], &top[j]);
+        }
+      }
+      break;
+    }
+    case OpCode::RationalPower:
+    {
+      T * top = stack[stackDepth - 1];
+      T p = constantAtIndex<T>(instruction.operand);
+      T q = constantAtIndex<T>(instruction.operand + 1);
+      // See PowerNode::computeNotPrincipalRealRootOfRationalPow
+      bool qIsOdd = std::pow(static_cast<T>(-1.0), q) < static_cast<T>(0.0);
+      bool pIsOdd = std::pow(static_cast<T>(-1.0), p) < static_cast<T>(0.0);
+      for (int j = 0; j < n; j++) {
+        if (statuses[j] != Status::Real) {
+          continue;
+        }
+        T c = top[j];
+        if (qIsOdd) {
+          T absolutePower;
+          statuses[j] = PowerOnReals(std::fabs(c), p/q, &absolutePower);
+          top[j] = c < static_cast<T>(0.0) && pIsOdd ? -absolutePower : absolutePower;
+        } else {
+          statuses[j] = PowerOnReals(c, p/q, &top[j]);
+        }
+      }
+      break;
+    }
+    case OpCode::Sine:
+    case OpCode::Cosine:
+    case OpCode::Tangent:
+    {
+      T * top = stack[stackDepth - 1];
+      for (int j = 0; j < n; j++) {
+        if (statuses[j] != Status::Real) {
+          continue;
+        }
+        std::complex<T> angleInput = Trigonometry::ConvertToRadian(std::complex<T>(top[j]), m_angleUnit);
+        std::complex<T> sine = std::sin(angleInput);
+        std::complex<T> res;
+        if (instruction.opCode == OpCode::Sine) {
+          res = sine;
+        } else if (instruction.opCode == OpCode::Cosine) {
+          res = std::cos(angleInput);
+        } else if (sine == std::complex<T>(1) || sine == std::complex<T>(-1)) {
+          // See TangentNode::computeOnComplex
+          statuses[j] = Status::Unhandled;
+          continue;
+        } else {
+          res = std::tan(angleInput);
+        }
+        statuses[j] = RealPart(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput), &top[j]);
+      }
+      break;
+    }
+    case OpCode::Logarithm:
+    {
+      // See LogarithmNode<2>::templatedApproximate
+      T * top = stack[stackDepth - 1];
+      std::complex<T> logarithmOfBase(constantAtIndex<T>(instruction.operand));
+      for (int j = 0; j < n; j++) {
+        if (statuses[j] != Status::Real) {
+          continue;
+        }
+        if (top[j] == static_cast<T>(0.0)) {
+          statuses[j] = Status::Unhandled;
+          continue;
+        }
+        statuses[j] = RealPart(std::log10(std::complex<T>(top[j])) / logarithmOfBase, &top[j]);
+      }
+      break;
+    }
+    default:
+    {
+      assert(instruction.opCode == OpCode::AbsoluteValue);
+      T * top = stack[stackDepth - 1];
+      for (int j = 0; j < n; j++) {
+        top[j] = std::fabs(top[j]);
+      }
+      break;
+    }
+    }
+    const T * top = stack[stackDepth - 1];
+    for (int j = 0; j < n; j++) {
+      if (statuses[j] == Status::Real && !std::isfinite(top[j])) {
+        statuses[j] = Status::Unhandled;
+      }
+    }
+  }
+  assert(stackDepth == 1);
+  for (int j = 0; j < n; j++) {
+    /* In real complex format, encountering a complex value makes the whole
+     * approximation undefined. */
+    results[j] = statuses[j] == Status::Nonreal ? NAN : stack[0][j];
+    handled[j] = statuses[j] != Status::Unhandled;
+  }
+}
+
+template<typename T>
+CompiledExpression::Status CompiledExpression::RealPart(std::complex<T> c, T * result) {
+  // Same condition as in ComplexNode's constructor
+  if (!std::isnan(c.imag()) && c.imag() != static_cast<T>(0.0)) {
+    return Status::Nonreal;
+  }
+  if (std::isnan(c.imag()) || !std::isfinite(c.real())) {
+    return Status::Unhandled;
+  }
+  *result = c.real();
+  return Status::Real;
+}
+
+template<typename T>
+CompiledExpression::Status CompiledExpression::PowerOnReals(T c, T d, T * result) {
+  // See PowerNode::computeOnComplex in real complex format
+  if (c != static_cast<T>(0.0) && (c > static_cast<T>(0.0) || std::round(d) == d)) {
+    *result = std::pow(c, d);
+    return Status::Real;
+  }
+  std::complex<T> complexC(c), complexD(d);
+  return RealPart(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(std::pow(complexC, complexD), complexC, complexD, false), result);
+}
+
+template<>
+float CompiledExpression::constantAtIndex<float>(int i) const {
+  assert(i < m_numberOfConstants);
+  return m_floatConstants[i];
+}
+
+template<>
+double CompiledExpression::constantAtIndex<double>(int i) const {
+  assert(i < m_numberOfConstants);
+  return m_doubleConstants[i];
+}
+
+bool CompiledExpression::IsConstant(const Expression e, Context * context) {
+  return !e.recursivelyMatches(
+      [](const Expression e, Context * context) {
+        return e.isRandom() || e.isOfType({ExpressionNode::Type::Symbol, ExpressionNode::Type::Function, ExpressionNode::Type::Sequence});
+      },
+      context,
+      ExpressionNode::SymbolicComputation::DoNotReplaceAnySymbol);
+}
+
+bool CompiledExpression::compileNode(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, int * stackDepth) {
+  if (*stackDepth >= k_maxStackDepth) {
+    return false;
+  }
+  if (IsConstant(e, context)) {
+    float floatValue = e.approximateToScalar<float>(context, complexFormat, m_angleUnit);
+    double doubleValue = e.approximateToScalar<double>(context, complexFormat, m_angleUnit);
+    if (!std::isfinite(floatValue) || !std::isfinite(doubleValue) || !pushConstant(floatValue, doubleValue)) {
+      return false;
+    }
+    *stackDepth += 1;
+    return true;
+  }
+  int numberOfChildren = e.numberOfChildren();
+  switch (e.type()) {
+  case ExpressionNode::Type::Symbol:
+    if (strcmp(static_cast<const Symbol &>(e).name(), symbol) != 0 || !pushInstruction(OpCode::Variable)) {
+      return false;
+    }
+    *stackDepth += 1;
+    return true;
+  case ExpressionNode::Type::Addition:
+  case ExpressionNode::Type::Multiplication:
+  {
+    // Children are reduced from left to right, as in ApproximationHelper::MapReduce
+    OpCode opCode = e.type() == ExpressionNode::Type::Addition ? OpCode::Addition : OpCode::Multiplication;
+    if (!compileNode(e.childAtIndex(0), symbol, context, complexFormat, stackDepth)) {
+      return false;
+    }
+    for (int i = 1; i < numberOfChildren; i++) {
+      if (!compileNode(e.childAtIndex(i), symbol, context, complexFormat, stackDepth) || !pushInstruction(opCode)) {
+        return false;
+      }
+      *stackDepth -= 1;
+    }
+    return true;
+  }
+  case ExpressionNode::Type::Power:
+  {
+    if (!compileNode(e.childAtIndex(0), symbol, context, complexFormat, stackDepth)) {
+      return false;
+    }
+    Expression index = e.childAtIndex(1);
+    if (index.type() == ExpressionNode::Type::Rational) {
+      // See PowerNode::templatedApproximate in real complex format
+      const Rational & r = static_cast<const Rational &>(index);
+      Integer p = r.signedIntegerNumerator();
+      Integer q = r.integerDenominator();
+      int pIndex = addConstant(p.approximate<float>(), p.approximate<double>());
+      int qIndex = addConstant(q.approximate<float>(), q.approximate<double>());
+      assert(qIndex < 0 || qIndex == pIndex + 1);
+      return qIndex >= 0 && pushInstruction(OpCode::RationalPower, pIndex);
+    }
+    if (!compileNode(index, symbol, context, complexFormat, stackDepth) || !pushInstruction(OpCode::Power)) {
+      return false;
+    }
+    *stackDepth -= 1;
+    return true;
+  }
+  case ExpressionNode::Type::Logarithm:
+  {
+    if (numberOfChildren != 2 || !compileNode(e.childAtIndex(0), symbol, context, complexFormat, stackDepth)) {
+      return false;
+    }
+    Expression base = e.childAtIndex(1);
+    if (!IsConstant(base, context) || Preferences::sharedPreferences()->basedLogarithmIsForbidden()) {
+      return false;
+    }
+    std::complex<float> floatLog = std::log10(std::complex<float>(base.approximateToScalar<float>(context, complexFormat, m_angleUnit)));
+    std::complex<double> doubleLog = std::log10(std::complex<double>(base.approximateToScalar<double>(context, complexFormat, m_angleUnit)));
+    if (floatLog.imag() != 0.0f || doubleLog.imag() != 0.0 || !std::isfinite(floatLog.real()) || !std::isfinite(doubleLog.real()) || floatLog.real() == 0.0f || doubleLog.real() == 0.0) {
+      return false;
+    }
+    int index = addConstant(floatLog.real(), doubleLog.real());
+    return index >= 0 && pushInstruction(OpCode::Logarithm, index);
+  }
+  case ExpressionNode::Type::Sine:
+  case ExpressionNode::Type::Cosine:
+  case ExpressionNode::Type::Tangent:
+  case ExpressionNode::Type::AbsoluteValue:
+  {
+    OpCode opCode;
+    switch (e.type()) {
+    case ExpressionNode::Type::Sine:
+      opCode = OpCode::Sine;
+      break;
+    case ExpressionNode::Type::Cosine:
+      opCode = OpCode::Cosine;
+      break;
+    case ExpressionNode::Type::Tangent:
+      opCode = OpCode::Tangent;
+      break;
+    default:
+      opCode = OpCode::AbsoluteValue;
+    }
+    return compileNode(e.childAtIndex(0), symbol, context, complexFormat, stackDepth) && pushInstruction(opCode);
+  }
+  default:
+    return false;
+  }
+}
+
+bool CompiledExpression::pushInstruction(OpCode opCode, uint8_t operand) {
+  if (m_numberOfInstructions >= k_maxNumberOfInstructions) {
+    return false;
+  }
+  m_instructions[m_numberOfInstructions++] = {opCode, operand};
+  return true;
+}
+
+int CompiledExpression::addConstant(float floatValue, double doubleValue) {
+  if (m_numberOfConstants >= k_maxNumberOfConstants) {
+    return -1;
+  }
+  m_floatConstants[m_numberOfConstants] = floatValue;
+  m_doubleConstants[m_numberOfConstants] = doubleValue;
+  return m_numberOfConstants++;
+}
+
+bool CompiledExpression::pushConstant(float floatValue, double doubleValue) {
+  int index = addConstant(floatValue, doubleValue);
+  return index >= 0 && pushInstruction(OpCode::Constant, index);
+}
+
+template bool CompiledExpression::approximateWithValueForSymbol<float>(float, float *) const;
+template bool CompiledExpression::approximateWithValueForSymbol<double>(double, double *) const;
+template void CompiledExpression::approximateWithValuesForSymbol<float>(const float *, float *, bool *, int) const;
+template void CompiledExpression::approximateWithValuesForSymbol<double>(const double *, double *, bool *, int) const;
+
+}
@@ -18,9 +18,32 @@ Expression Evaluation<T>::complexToExpression(Preferences::ComplexFormat complex
   return node()->complexToExpression(complexFormat);
 }
 
+template<typename T>
+void Evaluation<T>::appendComplexesInPlace(const std::complex<T> * complexes, int numberOfComplexes) {
+  // Nodes are allocated at the end of the pool
+  TreeNode * endOfChildren = TreeHandle::node()->nextSibling();
+  for (int i = 0; i < numberOfComplexes; i++) {
+    Complex<T> child = Complex<T>::Builder(complexes[i]);
+    TreeNode * childNode = child.TreeHandle::node();
+    int n = numberOfChildren();
+    if (childNode == endOfChildren) {
+      // The child already lies after the last child
+      childNode->retain();
+      childNode->setParentIdentifier(identifier());
+      TreeHandle::node()->incrementNumberOfChildren();
+      TreeHandle::node()->didChangeArity(n + 1);
+    } else {
+      addChildAtIndexInPlace(child, n, n);
+    }
+    endOfChildren = child.TreeHandle::node()->next();
+  }
+}
+
 template Evaluation<float> Evaluation<float>::childAtIndex(int i) const;
 template Evaluation<double> Evaluation<double>::childAtIndex(int i) const;
 template Expression Evaluation<float>::complexToExpression(Preferences::ComplexFormat) const;
 template Expression Evaluation<double>::complexToExpression(Preferences::ComplexFormat) const;
+template void Evaluation<float>::appendComplexesInPlace(const std::complex<float> *, int);
+template void Evaluation<double>::appendComplexesInPlace(const std::complex<double> *, int);
 
 }
@@ -5,6 +5,7 @@
 #include <poincare/based_integer.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/comparison_operator.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/constant.h>
 #include <poincare/decimal.h>
 #include <poincare/dependency.h>
@@ -18,6 +19,7 @@
 #include <poincare/parenthesis.h>
 #include <poincare/power.h>
 #include <poincare/rational.h>
+#include <poincare/reduction_cache.h>
 #include <poincare/real_part.h>
 #include <poincare/store.h>
 #include <poincare/string_layout.h>
@@ -28,6 +30,7 @@
 #include <poincare/variable_context.h>
 #include <ion.h>
 #include <ion/unicode/utf8_helper.h>
+#include <algorithm>
 #include <cmath>
 #include <float.h>
 #include <utility>
@@ -831,6 +834,15 @@ Expression Expression::reduceAndRemoveUnit(const ExpressionNode::ReductionContex
 
 Expression Expression::cloneAndDeepReduceWithSystemCheckpoint(ExpressionNode::ReductionContext * reductionContext, bool * reduceFailure) const {
   *reduceFailure = false;
+  ReductionCache * cache = ReductionCache::SharedCache();
+  const bool isCacheable = ReductionCache::IsCacheable(*this, reductionContext->context());
+  const ExpressionNode::ReductionTarget initialTarget = reductionContext->target();
+  if (isCacheable) {
+    Expression cached = cache->reducedExpression(*this, *reductionContext);
+    if (!cached.isUninitialized()) {
+      return cached;
+    }
+  }
 #if __EMSCRIPTEN__
   Expression e = clone().deepReduce(*reductionContext);
   {
@@ -874,6 +886,8 @@ failure:
   if (*reduceFailure) {
     // Cloning outside of ecp's scope in case it raises an exception
     e = clone();
+  } else if (isCacheable && reductionContext->target() == initialTarget) {
+    cache->storeReducedExpression(*this, *reductionContext, e);
   }
   assert(!e.isUninitialized());
   return e;
@@ -985,6 +999,24 @@ U Expression::approximateWithValueForSymbol(const char * symbol, U x, Context *
   return approximateToScalar<U>(&variableContext, complexFormat, angleUnit);
 }
 
+template<typename U>
+void Expression::approximateWithValuesForSymbol(const char * symbol, const U * x, U * results, int n, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  CompiledExpression compiledExpression;
+  bool isCompiled = compiledExpression.compile(*this, symbol, context, complexFormat, angleUnit);
+  bool handled[CompiledExpression::k_maxBatchSize];
+  for (int i = 0; i < n; i += CompiledExpression::k_maxBatchSize) {
+    int batchSize = std::min(n - i, CompiledExpression::k_maxBatchSize);
+    if (isCompiled) {
+      compiledExpression.approximateWithValuesForSymbol(x + i, results + i, handled, batchSize);
+    }
+    for (int j = 0; j < batchSize; j++) {
+      if (!isCompiled || !handled[j]) {
+        results[i + j] = approximateWithValueForSymbol(symbol, x[i + j], context, complexFormat, angleUnit);
+      }
+    }
+  }
+}
+
 /* Builder */
 
 bool Expression::IsZero(const Expression e) {
@@ -1202,4 +1234,7 @@ template Evaluation<double> Expression::approximateToEvaluation(Context * contex
 template float Expression::approximateWithValueForSymbol(const char * symbol, float x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 template double Expression::approximateWithValueForSymbol(const char * symbol, double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 
+template void Expression::approximateWithValuesForSymbol(const char * symbol, const float * x, float * results, int n, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template void Expression::approximateWithValuesForSymbol(const char * symbol, const double * x, double * results, int n, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+
 }
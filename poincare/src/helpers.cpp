@@ -1,6 +1,7 @@
 #include <poincare/helpers.h>
 #include <poincare/list.h>
 #include <assert.h>
+#include <algorithm>
 #include <cmath>
 
 namespace Poincare {
@@ -99,12 +100,12 @@ bool Rotate(uint32_t * dst, uint32_t * src, size_t len) {
   return true;
 }
 
-void Sort(Swap swap, Compare compare, void * context, int numberOfElements) {
-  /* Using an insertion-sort algorithm, which has the advantage of being
-   * in-place and efficient when already sorted. It is optimal if Compare is
-   * more lenient with equalities ( >= instead of > ) */
-  for (int i = 1; i < numberOfElements; i++) {
-    for (int j = i - 1; j >= 0; j--) {
+static void InsertionSort(Swap swap, Compare compare, void * context, int numberOfElements, int start, int end) {
+  /* Insertion sort is in-place and efficient on short or already sorted
+   * ranges. It is optimal if Compare is more lenient with equalities ( >=
+   * instead of > ) */
+  for (int i = start + 1; i < end; i++) {
+    for (int j = i - 1; j >= start; j--) {
       if (compare(j+1, j, context, numberOfElements)) {
         break;
       }
@@ -113,6 +114,145 @@ void Sort(Swap swap, Compare compare, void * context, int numberOfElements) {
   }
 }
 
+static void Reverse(Swap swap, void * context, int numberOfElements, int start, int end) {
+  for (int i = start, j = end - 1; i < j; i++, j--) {
+    swap(i, j, context, numberOfElements);
+  }
+}
+
+static void Merge(Swap swap, Compare compare, void * context, int numberOfElements, int start, int middle, int end) {
+  /* Merge the sorted ranges [start, middle) and [middle, end) in-place with
+   * the SymMerge algorithm (Kim & Kutzner, 2004), which uses
+   * O(m*log(n/m + 1)) comparisons where m <= n are the lengths of the ranges.
+   * An element r of the second range only goes before an element l of the
+   * first range if compare(r, l) is false, like in the insertion sort. The
+   * order of elements that compare equal is therefore the same as if the whole
+   * list had been insertion sorted. */
+  if (start >= middle || middle >= end) {
+    return;
+  }
+  if (middle - start == 1) {
+    // Find where to insert the single element of the first range
+    int i = middle;
+    int j = end;
+    while (i < j) {
+      int h = (i + j) / 2;
+      if (!compare(h, start, context, numberOfElements)) {
+        i = h + 1;
+      } else {
+        j = h;
+      }
+    }
+    for (int k = start; k < i - 1; k++) {
+      swap(k, k + 1, context, numberOfElements);
+    }
+    return;
+  }
+  if (end - middle == 1) {
+    // Find where to insert the single element of the second range
+    int i = start;
+    int j = middle;
+    while (i < j) {
+      int h = (i + j) / 2;
+      if (compare(middle, h, context, numberOfElements)) {
+        i = h + 1;
+      } else {
+        j = h;
+      }
+    }
+    for (int k = middle; k > i; k--) {
+      swap(k, k - 1, context, numberOfElements);
+    }
+    return;
+  }
+  int half = (start + end) / 2;
+  int n = half + middle;
+  int low = middle > half ? n - end : start;
+  int high = middle > half ? half : middle;
+  int p = n - 1;
+  while (low < high) {
+    int c = (low + high) / 2;
+    if (compare(p - c, c, context, numberOfElements)) {
+      low = c + 1;
+    } else {
+      high = c;
+    }
+  }
+  int blockStart = low;
+  int blockEnd = n - low;
+  // Rotate [blockStart, middle) and [middle, blockEnd)
+  if (blockStart < middle && middle < blockEnd) {
+    Reverse(swap, context, numberOfElements, blockStart, middle);
+    Reverse(swap, context, numberOfElements, middle, blockEnd);
+    Reverse(swap, context, numberOfElements, blockStart, blockEnd);
+  }
+  Merge(swap, compare, context, numberOfElements, start, blockStart, half);
+  Merge(swap, compare, context, numberOfElements, half, blockEnd, end);
+}
+
+void Sort(Swap swap, Compare compare, void * context, int numberOfElements) {
+  /* Using a bottom-up merge sort: blocks are insertion sorted, then merged
+   * in-place. It uses O(n*log(n)) comparisons and O(n*log(n)^2) swaps, and
+   * sorts in the same order as a plain insertion sort would. */
+  constexpr int k_blockSize = 16;
+  for (int start = 0; start < numberOfElements; start += k_blockSize) {
+    InsertionSort(swap, compare, context, numberOfElements, start, std::min(start + k_blockSize, numberOfElements));
+  }
+  for (int size = k_blockSize; size < numberOfElements; size *= 2) {
+    for (int start = 0; start + size < numberOfElements; start += 2 * size) {
+      Merge(swap, compare, context, numberOfElements, start, start + size, std::min(start + 2 * size, numberOfElements));
+    }
+  }
+}
+
+template <typename T>
+static void SiftDown(T * values, int root, int end) {
+  while (true) {
+    int child = 2 * root + 1;
+    if (child >= end) {
+      return;
+    }
+    if (child + 1 < end && values[child] < values[child + 1]) {
+      child++;
+    }
+    if (!(values[root] < values[child])) {
+      return;
+    }
+    std::swap(values[root], values[child]);
+    root = child;
+  }
+}
+
+template <typename T>
+void Sort(T * values, int numberOfElements, bool nanIsGreatest) {
+  // Gather the NaN at one end, the other values can then be compared with <
+  int start = 0;
+  int end = numberOfElements;
+  if (nanIsGreatest) {
+    for (int i = end - 1; i >= 0; i--) {
+      if (std::isnan(values[i])) {
+        std::swap(values[i], values[--end]);
+      }
+    }
+  } else {
+    for (int i = 0; i < end; i++) {
+      if (std::isnan(values[i])) {
+        std::swap(values[i], values[start++]);
+      }
+    }
+  }
+  // Heap sort the other values
+  T * heap = values + start;
+  int heapSize = end - start;
+  for (int i = heapSize / 2 - 1; i >= 0; i--) {
+    SiftDown(heap, i, heapSize);
+  }
+  for (int i = heapSize - 1; i > 0; i--) {
+    std::swap(heap[0], heap[i]);
+    SiftDown(heap, 0, i);
+  }
+}
+
 int ExtremumIndex(Compare compare, void * context, int numberOfElements, bool minimum) {
   int returnIndex = 0;
   for (int i = 0; i < numberOfElements; i++) {
@@ -153,6 +293,8 @@ bool RelativelyEqual(T observed, T expected, T relativeThreshold) {
   return std::fabs((observed - expected) / expected) <= relativeThreshold;
 }
 
+template void Sort<float>(float *, int, bool);
+template void Sort<double>(double *, int, bool);
 template bool RelativelyEqual<float>(float, float, float);
 template bool RelativelyEqual<double>(double, double, double);
 
@@ -33,7 +33,9 @@ namespace Poincare {
  * buffer). */
 // TODO: we might want to go back to allocating the native_uint_t arrays on the stack once we increase the stack size from 32k to?
 
-static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
+/* The working buffer holds one more digit than the largest (overflowing)
+ * Integer, so that a product can be computed in full before being checked. */
+static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 2];
 static native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
 
 uint8_t log2(native_uint_t v) {
@@ -436,14 +438,16 @@ Integer Integer::Power(const Integer & i, const Integer & j) {
   if (j.isOverflow() || i.isOverflow()) {
     return Overflow(false);
   }
-  // Exponentiate by squaring : i^j = (i*i)^(j/2) * i^(j%2)
+  /* Exponentiate by squaring : i^j = (i*i)^(j/2) * i^(j%2)
+   * The bits of j are read from the least significant one, and i2*i2 is
+   * computed as a square, which takes about half the digit products. */
   Integer i1(1);
   Integer i2(i);
-  Integer exp(j);
-  while (!exp.isOne()) {
-    IntegerDivision ud = udiv(exp, Integer(2));
-    exp = ud.quotient;
-    if (ud.remainder.isOne()) {
+  int numberOfDigits = j.numberOfDigits();
+  native_uint_t lastDigit = j.digit(numberOfDigits - 1);
+  int numberOfBits = (numberOfDigits - 1) * 32 + log2(lastDigit);
+  for (int bit = 0; bit < numberOfBits - 1; bit++) {
+    if ((j.digit(bit / 32) >> (bit % 32)) & 1) {
       i1 = Multiplication(i1, i2);
     }
     i2 = Multiplication(i2, i2);
@@ -451,18 +455,41 @@ Integer Integer::Power(const Integer & i, const Integer & j) {
   return Multiplication(i1, i2);
 }
 
+/* Product of the integers from first to last. Consecutive factors are gathered
+ * in a single digit, and the halves of longer ranges are multiplied together
+ * so that the operands of the multiplications stay balanced. */
+static Integer ProductOfRange(native_uint_t first, native_uint_t last) {
+  constexpr native_uint_t k_maxNumberOfGatheredFactors = 8;
+  if (last - first < k_maxNumberOfGatheredFactors) {
+    Integer result(1);
+    double_native_uint_t factors = 1;
+    for (double_native_uint_t factor = first; factor <= last; factor++) {
+      double_native_uint_t product = factors * factor;
+      if (product > UINT32_MAX) {
+        result = Integer::Multiplication(result, Integer(static_cast<double_native_int_t>(factors)));
+        product = factor;
+      }
+      factors = product;
+    }
+    return Integer::Multiplication(result, Integer(static_cast<double_native_int_t>(factors)));
+  }
+  native_uint_t middle = first + (last - first) / 2;
+  Integer lowerProduct = ProductOfRange(first, middle);
+  if (lowerProduct.isOverflow()) {
+    return lowerProduct;
+  }
+  return Integer::Multiplication(lowerProduct, ProductOfRange(middle + 1, last));
+}
+
 Integer Integer::Factorial(const Integer & i) {
   assert(!i.isNegative());
-  if (i.isOverflow()) {
+  if (i.isOverflow() || i.numberOfDigits() > 1) {
     return Overflow(false);
   }
-  Integer j(2);
-  Integer result(1);
-  while (ucmp(i,j) >= 0) {
-    result = Multiplication(j, result);
-    j = usum(j, Integer(1), false);
+  if (ucmp(i, Integer(2)) < 0) {
+    return Integer(1);
   }
-  return result;
+  return ProductOfRange(2, i.digit(0));
 }
 
 Integer Integer::addition(const Integer & a, const Integer & b, bool inverseBNegative, bool oneDigitOverflow) {
@@ -489,50 +516,190 @@ Integer Integer::addition(const Integer & a, const Integer & b, bool inverseBNeg
   }
 }
 
-Integer Integer::multiplication(const Integer & a, const Integer & b, bool oneDigitOverflow) {
-  if (a.isOverflow() || b.isOverflow()) {
-    return Integer::Overflow(a.m_negative != b.m_negative);
+/* Digits products work on little-endian digit arrays. The result of the
+ * product of a (na digits) by b (nb digits) has na+nb digits, the most
+ * significant of which may be 0. */
+
+static void SchoolbookMultiplication(const native_uint_t * a, int na, const native_uint_t * b, int nb, native_uint_t * result) {
+  memset(result, 0, (na + nb) * sizeof(native_uint_t));
+  for (int i = 0; i < na; i++) {
+    /* The fact that aDigit is double_native is very important, otherwise the
+     * product might end up being computed on single_native size and then
+     * zero-padded. (2^32-1)^2 + 2*(2^32-1) = 2^64-1 so p cannot overflow. */
+    double_native_uint_t aDigit = a[i];
+    double_native_uint_t carry = 0;
+    for (int j = 0; j < nb; j++) {
+      double_native_uint_t p = aDigit * b[j] + result[i + j] + carry;
+      result[i + j] = static_cast<native_uint_t>(p);
+      carry = p >> 32;
+    }
+    result[i + nb] = static_cast<native_uint_t>(carry);
   }
+}
 
-  uint8_t size = std::min(a.numberOfDigits() + b.numberOfDigits(), k_maxNumberOfDigits + oneDigitOverflow); // Enable overflowing of 1 digit
+static void SchoolbookSquaring(const native_uint_t * a, int n, native_uint_t * result) {
+  memset(result, 0, 2 * n * sizeof(native_uint_t));
+  // Products a[i]*a[j] with i < j appear twice in the square: compute them once
+  for (int i = 0; i < n; i++) {
+    double_native_uint_t aDigit = a[i];
+    double_native_uint_t carry = 0;
+    for (int j = i + 1; j < n; j++) {
+      double_native_uint_t p = aDigit * a[j] + result[i + j] + carry;
+      result[i + j] = static_cast<native_uint_t>(p);
+      carry = p >> 32;
+    }
+    result[i + n] = static_cast<native_uint_t>(carry);
+  }
+  // Double them, then add the squares a[i]*a[i]
+  native_uint_t shiftedBit = 0;
+  for (int i = 0; i < 2 * n; i++) {
+    native_uint_t d = result[i];
+    result[i] = (d << 1) | shiftedBit;
+    shiftedBit = d >> 31;
+  }
+  assert(shiftedBit == 0);
+  double_native_uint_t carry = 0;
+  for (int i = 0; i < n; i++) {
+    double_native_uint_t p = static_cast<double_native_uint_t>(a[i]) * a[i];
+    double_native_uint_t s = result[2 * i] + (p & UINT32_MAX) + carry;
+    result[2 * i] = static_cast<native_uint_t>(s);
+    s = result[2 * i + 1] + (p >> 32) + (s >> 32);
+    result[2 * i + 1] = static_cast<native_uint_t>(s);
+    carry = s >> 32;
+  }
+  assert(carry == 0);
+}
 
-  memset(s_workingBuffer, 0, size*sizeof(native_uint_t));
+// result = x + y, result has std::max(nx, ny) + 1 digits
+static void AddDigits(const native_uint_t * x, int nx, const native_uint_t * y, int ny, native_uint_t * result) {
+  int n = std::max(nx, ny);
+  native_uint_t carry = 0;
+  for (int i = 0; i < n; i++) {
+    double_native_uint_t s = static_cast<double_native_uint_t>(i < nx ? x[i] : 0) + (i < ny ? y[i] : 0) + carry;
+    result[i] = static_cast<native_uint_t>(s);
+    carry = s >> 32;
+  }
+  result[n] = carry;
+}
 
-  double_native_uint_t carry = 0;
-  for (uint8_t i = 0; i < a.numberOfDigits(); i++) {
-    double_native_uint_t aDigit = a.digit(i);
-    carry = 0;
-    for (uint8_t j = 0; j < b.numberOfDigits(); j++) {
-      double_native_uint_t bDigit = b.digit(j);
-      /* The fact that aDigit and bDigit are double_native is very important,
-       * otherwise the product might end up being computed on single_native size
-       * and then zero-padded. */
-      double_native_uint_t p = aDigit*bDigit + carry; // TODO: Prove it cannot overflow double_native type
-      native_uint_t * l = (native_uint_t *)&p;
-      if (i+j < (uint8_t) k_maxNumberOfDigits+oneDigitOverflow) {
-        p += s_workingBuffer[i+j];
-        s_workingBuffer[i+j] = l[0];
-      } else {
-        if (l[0] != 0) {
-          // Overflow the largest Integer
-          return Integer::Overflow(a.m_negative != b.m_negative);
-        }
-      }
-      carry = l[1];
+// x += y, the sum must fit in the nx >= ny digits of x
+static void AddDigitsInPlace(native_uint_t * x, int nx, const native_uint_t * y, int ny) {
+  assert(nx >= ny);
+  native_uint_t carry = 0;
+  for (int i = 0; i < nx && (i < ny || carry != 0); i++) {
+    double_native_uint_t s = static_cast<double_native_uint_t>(x[i]) + (i < ny ? y[i] : 0) + carry;
+    x[i] = static_cast<native_uint_t>(s);
+    carry = s >> 32;
+  }
+  assert(carry == 0);
+}
+
+// x -= y, x must be greater than y and nx >= ny
+static void SubtractDigitsInPlace(native_uint_t * x, int nx, const native_uint_t * y, int ny) {
+  assert(nx >= ny);
+  native_uint_t borrow = 0;
+  for (int i = 0; i < nx && (i < ny || borrow != 0); i++) {
+    native_uint_t yDigit = i < ny ? y[i] : 0;
+    native_uint_t d = x[i] - yDigit - borrow;
+    borrow = (x[i] < yDigit) || (borrow && x[i] == yDigit);
+    x[i] = d;
+  }
+  assert(borrow == 0);
+}
+
+/* Below this number of digits of the smallest operand, the schoolbook
+ * multiplication is faster than Karatsuba's. */
+constexpr static int k_karatsubaThreshold = 16;
+
+/* Karatsuba's multiplication splits the operands at m digits:
+ * a = a1*B^m + a0 and b = b1*B^m + b0, then
+ * a*b = z2*B^2m + z1*B^m + z0 with z0 = a0*b0, z2 = a1*b1 and
+ * z1 = (a0+a1)*(b0+b1) - z0 - z2, which takes 3 products of half the size
+ * instead of 4. The sums and z1 are computed in scratch, followed by the
+ * scratch of the inner products. */
+constexpr static int KaratsubaScratchSize(int minNumberOfDigits, int numberOfDigits) {
+  /* numberOfDigits is na+nb. With m = min(na, nb)/2, the inner products are
+   * z0 on (m, m) digits, z2 on (na-m, nb-m) and z1 on (na-m+1, nb-m+1). */
+  return minNumberOfDigits < k_karatsubaThreshold ? 0 :
+    2 * (numberOfDigits - 2 * (minNumberOfDigits / 2) + 2)
+    + std::max(
+        std::max(
+          KaratsubaScratchSize(minNumberOfDigits / 2, 2 * (minNumberOfDigits / 2)),
+          KaratsubaScratchSize(minNumberOfDigits - minNumberOfDigits / 2, numberOfDigits - 2 * (minNumberOfDigits / 2))),
+        KaratsubaScratchSize(minNumberOfDigits - minNumberOfDigits / 2 + 1, numberOfDigits - 2 * (minNumberOfDigits / 2) + 2));
+}
+
+constexpr static int MaxKaratsubaScratchSize(int maxNumberOfDigits) {
+  int result = 0;
+  for (int numberOfDigits = 2 * k_karatsubaThreshold; numberOfDigits <= maxNumberOfDigits; numberOfDigits++) {
+    for (int minNumberOfDigits = k_karatsubaThreshold; 2 * minNumberOfDigits <= numberOfDigits; minNumberOfDigits++) {
+      result = std::max(result, KaratsubaScratchSize(minNumberOfDigits, numberOfDigits));
     }
-    if (i+b.numberOfDigits() < (uint8_t) k_maxNumberOfDigits+oneDigitOverflow) {
-      s_workingBuffer[i+b.numberOfDigits()] += carry;
+  }
+  return result;
+}
+
+// Products never exceed the working buffer
+static native_uint_t s_karatsubaScratch[std::max(1, MaxKaratsubaScratchSize(Integer::k_maxNumberOfDigits + 2))];
+
+static void MultiplyDigits(const native_uint_t * a, int na, const native_uint_t * b, int nb, native_uint_t * result, native_uint_t * scratch) {
+  bool isSquaring = a == b && na == nb;
+  if (std::min(na, nb) < k_karatsubaThreshold) {
+    if (isSquaring) {
+      SchoolbookSquaring(a, na, result);
     } else {
-      if (carry != 0) {
-        // Overflow the largest Integer
-        return Integer::Overflow(a.m_negative != b.m_negative);
-      }
+      SchoolbookMultiplication(a, na, b, nb, result);
     }
+    return;
   }
-  while (size>0 && s_workingBuffer[size-1] == 0) {
+  int m = std::min(na, nb) / 2;
+  int nsa = na - m + 1;
+  int nsb = nb - m + 1;
+  int nz1 = nsa + nsb;
+  native_uint_t * sa = scratch;
+  native_uint_t * sb = isSquaring ? sa : sa + nsa;
+  native_uint_t * z1 = sa + nsa + nsb;
+  native_uint_t * innerScratch = z1 + nz1;
+  AddDigits(a, m, a + m, na - m, sa);
+  if (!isSquaring) {
+    AddDigits(b, m, b + m, nb - m, sb);
+  }
+  // z0 and z2 are computed in place
+  MultiplyDigits(a, m, b, m, result, innerScratch);
+  MultiplyDigits(a + m, na - m, b + m, nb - m, result + 2 * m, innerScratch);
+  MultiplyDigits(sa, nsa, sb, nsb, z1, innerScratch);
+  SubtractDigitsInPlace(z1, nz1, result, 2 * m);
+  SubtractDigitsInPlace(z1, nz1, result + 2 * m, na + nb - 2 * m);
+  AddDigitsInPlace(result + m, na + nb - m, z1, nz1);
+}
+
+Integer Integer::multiplication(const Integer & a, const Integer & b, bool oneDigitOverflow) {
+  bool negative = a.m_negative != b.m_negative;
+  if (a.isOverflow() || b.isOverflow()) {
+    return Integer::Overflow(negative);
+  }
+
+  int maxNumberOfDigits = k_maxNumberOfDigits + oneDigitOverflow; // Enable overflowing of 1 digit
+  int na = a.numberOfDigits();
+  int nb = b.numberOfDigits();
+  if (na == 0 || nb == 0) {
+    return Integer(0);
+  }
+  // A product has at least na+nb-1 digits
+  if (na + nb - 1 > maxNumberOfDigits) {
+    // Overflow the largest Integer
+    return Integer::Overflow(negative);
+  }
+  assert(na + nb <= k_maxNumberOfDigits + 2);
+  MultiplyDigits(a.digits(), na, b.digits(), nb, s_workingBuffer, s_karatsubaScratch);
+  int size = na + nb;
+  while (size > 0 && s_workingBuffer[size-1] == 0) {
     size--;
   }
-  return BuildInteger(s_workingBuffer, size, a.m_negative != b.m_negative, oneDigitOverflow);
+  if (size > maxNumberOfDigits) {
+    return Integer::Overflow(negative);
+  }
+  return BuildInteger(s_workingBuffer, size, negative, oneDigitOverflow);
 }
 
 int8_t Integer::ucmp(const Integer & a, const Integer & b) {
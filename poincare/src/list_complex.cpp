@@ -8,9 +8,27 @@ namespace Poincare {
 template<typename T>
 std::complex<T> ListComplexNode<T>::complexAtIndex(int index) const {
   assert(index < m_numberOfChildren);
-  EvaluationNode<T> * child = EvaluationNode<T>::childAtIndex(index);
+  return ComplexOfChild(EvaluationNode<T>::childAtIndex(index));
+}
+
+template<typename T>
+void ListComplexNode<T>::complexesAtIndexes(int startIndex, int numberOfComplexes, std::complex<T> * complexes) const {
+  assert(startIndex >= 0 && numberOfComplexes >= 0 && startIndex + numberOfComplexes <= numberOfChildren());
+  if (numberOfComplexes == 0) {
+    return;
+  }
+  EvaluationNode<T> * child = EvaluationNode<T>::childAtIndex(startIndex);
+  complexes[0] = ComplexOfChild(child);
+  for (int i = 1; i < numberOfComplexes; i++) {
+    child = static_cast<EvaluationNode<T> *>(child->nextSibling());
+    complexes[i] = ComplexOfChild(child);
+  }
+}
+
+template<typename T>
+std::complex<T> ListComplexNode<T>::ComplexOfChild(const EvaluationNode<T> * child) {
   if (child->type() == EvaluationNode<T>::Type::Complex) {
-    return *(static_cast<ComplexNode<T> *>(child));
+    return *(static_cast<const ComplexNode<T> *>(child));
   }
   return std::complex<T>(NAN, NAN);
 }
@@ -189,6 +189,52 @@ int Matrix::ArrayInverse(T * array, int numberOfRows, int numberOfColumns) {
   return 0;
 }
 
+template<typename T>
+void Matrix::ArrayMultiply(const T * array1, const T * array2, T * result, int numberOfRows1, int numberOfColumns1, int numberOfColumns2) {
+  assert(result != array1 && result != array2);
+  for (int i = 0; i < numberOfRows1*numberOfColumns2; i++) {
+    result[i] = 0.0;
+  }
+  /* Iterating on k before j walks through the rows of array2 and result
+   * contiguously. Each coefficient still sums its terms in increasing k. */
+  for (int i = 0; i < numberOfRows1; i++) {
+    for (int k = 0; k < numberOfColumns1; k++) {
+      T factor = array1[i*numberOfColumns1+k];
+      for (int j = 0; j < numberOfColumns2; j++) {
+        result[i*numberOfColumns2+j] += factor*array2[k*numberOfColumns2+j];
+      }
+    }
+  }
+}
+
+template<typename T>
+void Matrix::ArrayPower(T * array, int dim, int power) {
+  assert(dim*dim <= k_maxNumberOfCoefficients);
+  assert(power >= 0);
+  T base[k_maxNumberOfCoefficients];
+  T product[k_maxNumberOfCoefficients];
+  for (int i = 0; i < dim*dim; i++) {
+    base[i] = array[i];
+    array[i] = i/dim == i%dim ? 1.0 : 0.0;
+  }
+  // Exponentiation by squaring: array holds the product of the used squares
+  while (power > 0) {
+    if (power & 1) {
+      ArrayMultiply(array, base, product, dim, dim, dim);
+      for (int i = 0; i < dim*dim; i++) {
+        array[i] = product[i];
+      }
+    }
+    power >>= 1;
+    if (power > 0) {
+      ArrayMultiply(base, base, product, dim, dim, dim);
+      for (int i = 0; i < dim*dim; i++) {
+        base[i] = product[i];
+      }
+    }
+  }
+}
+
 Matrix Matrix::rowCanonize(const ExpressionNode::ReductionContext& reductionContext, Expression * determinant, bool reduced) {
   // The matrix children have to be reduced to be able to spot 0
   deepReduceChildren(reductionContext);
@@ -298,7 +344,9 @@ void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns,
   int k = 0; // column pivot
 
   while (h < numberOfRows && k < numberOfColumns) {
-    // Find the biggest pivot (in absolute value). See comment on rowCanonize.
+    /* Find the biggest pivot (in absolute value). See comment on rowCanonize.
+     * Unlike rowCanonize, the biggest pivot is also taken in reduced form:
+     * dividing by a small approximate pivot would amplify rounding errors. */
     int iPivot_temp = h;
     int iPivot = h;
     // Using double to stay accurate with any type T
@@ -309,11 +357,6 @@ void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns,
         // Update best pivot
         bestPivot = pivot;
         iPivot = iPivot_temp;
-        if (reduced) {
-          /* In reduced form, taking the first non null pivot is enough, and
-           * more efficient. */
-          break;
-        }
       }
       iPivot_temp++;
     }
@@ -606,5 +649,9 @@ template int Matrix::ArrayInverse<std::complex<float>>(std::complex<float> *, in
 template int Matrix::ArrayInverse<std::complex<double>>(std::complex<double> *, int, int);
 template void Matrix::ArrayRowCanonize<std::complex<float> >(std::complex<float>*, int, int, std::complex<float>*, bool);
 template void Matrix::ArrayRowCanonize<std::complex<double> >(std::complex<double>*, int, int, std::complex<double>*, bool);
+template void Matrix::ArrayMultiply<std::complex<float>>(const std::complex<float> *, const std::complex<float> *, std::complex<float> *, int, int, int);
+template void Matrix::ArrayMultiply<std::complex<double>>(const std::complex<double> *, const std::complex<double> *, std::complex<double> *, int, int, int);
+template void Matrix::ArrayPower<std::complex<float>>(std::complex<float> *, int, int);
+template void Matrix::ArrayPower<std::complex<double>>(std::complex<double> *, int, int);
 
 }
@@ -19,6 +19,32 @@ std::complex<T> MatrixComplexNode<T>::complexAtIndex(int index) const {
   return std::complex<T>(NAN, NAN);
 }
 
+template<typename T>
+void MatrixComplexNode<T>::copyComplexes(std::complex<T> * operands) const {
+  int i = 0;
+  for (EvaluationNode<T> * c : this->children()) {
+    // complex<T>(NAN, NAN) if Node type is not Complex
+    operands[i++] = c->type() == EvaluationNode<T>::Type::Complex ? *(static_cast<ComplexNode<T> *>(c)) : std::complex<T>(NAN, NAN);
+  }
+}
+
+template<typename T>
+void MatrixComplexNode<T>::multiplyComplexes(const std::complex<T> * operands, int numberOfColumns, std::complex<T> * result) const {
+  for (int i = 0; i < m_numberOfRows*numberOfColumns; i++) {
+    result[i] = 0.0;
+  }
+  int index = 0;
+  for (EvaluationNode<T> * c : this->children()) {
+    std::complex<T> factor = c->type() == EvaluationNode<T>::Type::Complex ? *(static_cast<ComplexNode<T> *>(c)) : std::complex<T>(NAN, NAN);
+    int i = index / m_numberOfColumns;
+    int k = index % m_numberOfColumns;
+    for (int j = 0; j < numberOfColumns; j++) {
+      result[i*numberOfColumns+j] += factor*operands[k*numberOfColumns+j];
+    }
+    index++;
+  }
+}
+
 template<typename T>
 Expression MatrixComplexNode<T>::complexToExpression(Preferences::ComplexFormat complexFormat) const {
   if (isUndefined()) {
@@ -63,11 +89,10 @@ std::complex<T> MatrixComplexNode<T>::determinant() const {
     return std::complex<T>(NAN, NAN);
   }
   std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
-  for (int i = 0; i < numberOfChildren(); i++) {
-    operandsCopy[i] = complexAtIndex(i); // Returns complex<T>(NAN, NAN) if Node type is not Complex
-  }
+  copyComplexes(operandsCopy);
   std::complex<T> determinant = std::complex<T>(1);
-  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, &determinant);
+  // The row echelon form is enough to compute the determinant
+  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, &determinant, false);
   return determinant;
 }
 
@@ -77,14 +102,8 @@ MatrixComplex<T> MatrixComplexNode<T>::inverse() const {
     return MatrixComplex<T>::Undefined();
   }
   std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
-  int i = 0;
-  for (EvaluationNode<T> * c : this->children()) {
-    if (c->type() != EvaluationNode<T>::Type::Complex) {
-      return MatrixComplex<T>::Undefined();
-    }
-    operandsCopy[i] = complexAtIndex(i);
-    i++;
-  }
+  // Children which are not Complex are copied as NAN, which is not invertible
+  copyComplexes(operandsCopy);
   int result = Matrix::ArrayInverse(operandsCopy, m_numberOfRows, m_numberOfColumns);
   if (result == 0) {
     /* Intentionally swapping dimensions for inverse, although it doesn't make a
@@ -114,9 +133,7 @@ MatrixComplex<T> MatrixComplexNode<T>::ref(bool reduced) const {
     return MatrixComplex<T>::Undefined();
   }
   std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
-  for (int i = 0; i < numberOfChildren(); i++) {
-    operandsCopy[i] = complexAtIndex(i); // Returns complex<T>(NAN, NAN) if Node type is not Complex
-  }
+  copyComplexes(operandsCopy);
   /* Reduced row echelon form is also called row canonical form. To compute the
    * row echelon form (non reduced one), fewer steps are required. */
   Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, static_cast<std::complex<T>*>(nullptr), reduced);
@@ -162,11 +179,9 @@ Evaluation<T> MatrixComplexNode<T>::cross(MatrixComplex<T> * e) const {
 // MATRIX COMPLEX REFERENCE
 
 template<typename T>
-MatrixComplex<T> MatrixComplex<T>::Builder(std::complex<T> * operands, int numberOfRows, int numberOfColumns) {
+MatrixComplex<T> MatrixComplex<T>::Builder(const std::complex<T> * operands, int numberOfRows, int numberOfColumns) {
   MatrixComplex<T> m = MatrixComplex<T>::Builder();
-  for (int i=0; i<numberOfRows*numberOfColumns; i++) {
-    m.addChildAtIndexInPlace(Complex<T>::Builder(operands[i]), i, i);
-  }
+  m.appendComplexesInPlace(operands, numberOfRows*numberOfColumns);
   m.setDimensions(numberOfRows, numberOfColumns);
   return m;
 }
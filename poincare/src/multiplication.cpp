@@ -135,6 +135,16 @@ MatrixComplex<T> MultiplicationNode::computeOnMatrices(const MatrixComplex<T> m,
   if (m.numberOfColumns() != n.numberOfRows()) {
     return MatrixComplex<T>::Undefined();
   }
+  if (m.numberOfChildren() <= Matrix::k_maxNumberOfCoefficients && n.numberOfChildren() <= Matrix::k_maxNumberOfCoefficients && m.numberOfRows()*n.numberOfColumns() <= Matrix::k_maxNumberOfCoefficients) {
+    /* Only n and the product are copied on the stack: the coefficients of m
+     * are read from the pool as the product consumes them. */
+    std::complex<T> operandsN[Matrix::k_maxNumberOfCoefficients];
+    std::complex<T> operandsResult[Matrix::k_maxNumberOfCoefficients];
+    n.copyComplexes(operandsN);
+    m.multiplyComplexes(operandsN, n.numberOfColumns(), operandsResult);
+    return MatrixComplex<T>::Builder(operandsResult, m.numberOfRows(), n.numberOfColumns());
+  }
+  // Matrices too big to be copied are multiplied in the pool
   MatrixComplex<T> result = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfRows(); i++) {
     for (int j = 0; j < n.numberOfColumns(); j++) {
@@ -306,19 +306,36 @@ template<typename T> MatrixComplex<T> PowerNode::computeOnMatrixAndComplex(const
   if (std::isnan(power) || std::isinf(power) || power != (int)power || std::fabs(power) > k_maxApproximatePowerMatrix) {
     return MatrixComplex<T>::Undefined();
   }
-  if (power < 0) {
-    MatrixComplex<T> inverse = m.inverse();
-    if (inverse.isUninitialized()) {
-      return MatrixComplex<T>::Undefined();
+  if (m.numberOfChildren() <= Matrix::k_maxNumberOfCoefficients) {
+    std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
+    m.copyComplexes(operandsCopy);
+    /* Inverting here rather than in ArrayPower keeps the buffers of the
+     * inversion and of the exponentiation off the stack at the same time. */
+    if (power < 0) {
+      if (Matrix::ArrayInverse(operandsCopy, m.numberOfRows(), m.numberOfColumns()) < 0) {
+        return MatrixComplex<T>::Undefined();
+      }
+      power = -power;
     }
-    Complex<T> minusC = Complex<T>::Builder(-d);
-    MatrixComplex<T> result = PowerNode::computeOnMatrixAndComplex(inverse, minusC.complexAtIndex(0), complexFormat);
-    return result;
+    Matrix::ArrayPower(operandsCopy, m.numberOfRows(), static_cast<int>(power));
+    return MatrixComplex<T>::Builder(operandsCopy, m.numberOfRows(), m.numberOfColumns());
+  }
+  // Matrices too big to be copied cannot be inverted
+  if (power < 0) {
+    return MatrixComplex<T>::Undefined();
   }
+  // Exponentiation by squaring in the pool
   MatrixComplex<T> result = MatrixComplex<T>::CreateIdentity(m.numberOfRows());
-  // TODO: implement a quick exponentiation
-  for (int k = 0; k < (int)power; k++) {
-    result = MultiplicationNode::computeOnMatrices<T>(result, m, complexFormat);
+  MatrixComplex<T> base = m;
+  int p = static_cast<int>(power);
+  while (p > 0) {
+    if (p & 1) {
+      result = MultiplicationNode::computeOnMatrices<T>(result, base, complexFormat);
+    }
+    p >>= 1;
+    if (p > 0) {
+      base = MultiplicationNode::computeOnMatrices<T>(base, base, complexFormat);
+    }
   }
   return result;
 }
@@ -1,4 +1,5 @@
 #include <poincare/preferences.h>
+#include <poincare/reduction_cache.h>
 #include <ion/include/ion/persisting_bytes.h>
 #include <assert.h>
 
@@ -71,6 +72,8 @@ void Preferences::setExamMode(ExamMode mode, PressToTestParams newPressToTestPar
   Ion::PersistingBytes::write(newPressToTestParams.m_value | (static_cast<uint8_t>(mode) << 8));
   m_examMode = mode;
   m_pressToTestParams = newPressToTestParams;
+  // Exam modes forbid some functions which changes how they are reduced
+  ReductionCache::SharedCache()->clear();
 }
 
 bool Preferences::equationSolverIsForbidden() const {
@@ -0,0 +1,126 @@
+#include <poincare/reduction_cache.h>
+#include <string.h>
+
+namespace Poincare {
+
+ReductionCache * ReductionCache::SharedCache() {
+  static ReductionCache cache;
+  return &cache;
+}
+
+Expression ReductionCache::reducedExpression(const Expression e, const ExpressionNode::ReductionContext & reductionContext) {
+  char serialization[k_maxSerializationLength];
+  int serializationLength = Serialize(e, serialization);
+  if (serializationLength < 0) {
+    return Expression();
+  }
+  Key key = KeyForExpression(e, serialization, serializationLength, reductionContext);
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    Entry * entry = m_entries + i;
+    if (entry->isEmpty() || !(entry->key == key) || entry->serializationLength != serializationLength) {
+      continue;
+    }
+    // Confirm the hit, the hash alone could collide
+    const char * entryBuffer = reinterpret_cast<const char *>(entry->buffer);
+    if (strncmp(entryBuffer + entry->inputSize + entry->reducedSize, serialization, serializationLength) != 0
+        || !Expression::ExpressionFromAddress(entryBuffer, entry->inputSize).isIdenticalTo(e)) {
+      continue;
+    }
+    entry->lastAccess = ++m_numberOfAccesses;
+    return Expression::ExpressionFromAddress(entryBuffer + entry->inputSize, entry->reducedSize);
+  }
+  return Expression();
+}
+
+void ReductionCache::storeReducedExpression(const Expression e, const ExpressionNode::ReductionContext & reductionContext, const Expression reduced) {
+  char serialization[k_maxSerializationLength];
+  int serializationLength = Serialize(e, serialization);
+  size_t inputSize = e.size();
+  size_t reducedSize = reduced.size();
+  if (serializationLength < 0 || inputSize + reducedSize + serializationLength > k_entryBufferSize) {
+    return;
+  }
+  // Replace an empty entry or else the least recently used one
+  Entry * entry = m_entries;
+  for (int i = 1; i < k_numberOfEntries && !entry->isEmpty(); i++) {
+    if (m_entries[i].isEmpty() || m_entries[i].lastAccess < entry->lastAccess) {
+      entry = m_entries + i;
+    }
+  }
+  entry->key = KeyForExpression(e, serialization, serializationLength, reductionContext);
+  entry->inputSize = inputSize;
+  entry->reducedSize = reducedSize;
+  entry->serializationLength = serializationLength;
+  entry->lastAccess = ++m_numberOfAccesses;
+  char * entryBuffer = reinterpret_cast<char *>(entry->buffer);
+  memcpy(entryBuffer, e.addressInPool(), inputSize);
+  memcpy(entryBuffer + inputSize, reduced.addressInPool(), reducedSize);
+  memcpy(entryBuffer + inputSize + reducedSize, serialization, serializationLength);
+}
+
+void ReductionCache::clear() {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    m_entries[i].inputSize = 0;
+  }
+}
+
+bool ReductionCache::IsCacheable(const Expression e, Context * context) {
+  /* ComplexCartesian only appears within reduction and cannot be serialized
+   * to confirm a hit. */
+  return !e.recursivelyMatches(
+      [](const Expression e, Context * context) {
+        return e.isRandom() || e.isOfType({ExpressionNode::Type::Symbol, ExpressionNode::Type::Function, ExpressionNode::Type::Sequence, ExpressionNode::Type::Store, ExpressionNode::Type::ComplexCartesian});
+      },
+      context,
+      ExpressionNode::SymbolicComputation::DoNotReplaceAnySymbol);
+}
+
+bool ReductionCache::Key::operator==(const Key & other) const {
+  return hash == other.hash
+    && complexFormat == other.complexFormat
+    && angleUnit == other.angleUnit
+    && unitFormat == other.unitFormat
+    && target == other.target
+    && symbolicComputation == other.symbolicComputation
+    && unitConversion == other.unitConversion;
+}
+
+// FNV-1a
+constexpr static uint32_t k_hashOffsetBasis = 2166136261;
+constexpr static uint32_t k_hashPrime = 16777619;
+
+uint32_t ReductionCache::Hash(const Expression e, uint32_t hash) {
+  hash = (hash ^ static_cast<uint32_t>(e.type())) * k_hashPrime;
+  int numberOfChildren = e.numberOfChildren();
+  hash = (hash ^ static_cast<uint32_t>(numberOfChildren)) * k_hashPrime;
+  for (int i = 0; i < numberOfChildren; i++) {
+    hash = Hash(e.childAtIndex(i), hash);
+  }
+  return hash;
+}
+
+uint32_t ReductionCache::Hash(const char * text, int length, uint32_t hash) {
+  for (int i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(text[i])) * k_hashPrime;
+  }
+  return hash;
+}
+
+int ReductionCache::Serialize(const Expression e, char * buffer) {
+  int length = e.serialize(buffer, k_maxSerializationLength);
+  return length < k_maxSerializationLength - 1 ? length : -1;
+}
+
+ReductionCache::Key ReductionCache::KeyForExpression(const Expression e, const char * serialization, int serializationLength, const ExpressionNode::ReductionContext & reductionContext) {
+  return Key {
+    Hash(serialization, serializationLength, Hash(e, k_hashOffsetBasis)),
+    reductionContext.complexFormat(),
+    reductionContext.angleUnit(),
+    reductionContext.unitFormat(),
+    reductionContext.target(),
+    reductionContext.symbolicComputation(),
+    reductionContext.unitConversion()
+  };
+}
+
+}
@@ -160,7 +160,8 @@ int StatisticsDataset<T>::indexAtCumulatedWeight(T weight, int * upperIndex) con
 template<typename T>
 int StatisticsDataset<T>::indexAtSortedIndex(int i) const {
   buildSortedIndex();
-  return static_cast<int>(m_sortedIndex.valueAtIndex(i));
+  assert(0 <= i && i < datasetLength());
+  return hasNativeSortedIndex() ? m_nativeSortedIndex[i] : static_cast<int>(m_sortedIndex.valueAtIndex(i));
 }
 
 template<typename T>
@@ -168,30 +169,55 @@ void StatisticsDataset<T>::buildSortedIndex() const {
   if (!m_recomputeSortedIndex) {
     return;
   }
-  FloatList<float> sortedIndexes = FloatList<float>::Builder();
-  for (int i = 0; i < datasetLength(); i++) {
-    sortedIndexes.addValueAtIndex(static_cast<float>(i), i);
-  }
-  void * pack[] = {&sortedIndexes, const_cast<DatasetColumn<T> *>(m_values)};
-  Helpers::Sort(
-      [](int i, int j, void * ctx, int n) { // swap
-        void ** pack = reinterpret_cast<void **>(ctx);
-        FloatList<float> * sortedIndex = reinterpret_cast<FloatList<float> *>(pack[0]);
-        float temp = sortedIndex->valueAtIndex(i);
-        sortedIndex->replaceValueAtIndex(sortedIndex->valueAtIndex(j), i);
-        sortedIndex->replaceValueAtIndex(temp, j);
-      },
-      [](int i, int j, void * ctx, int n) { // compare
-        void ** pack = reinterpret_cast<void **>(ctx);
-        FloatList<float> * sortedIndex = reinterpret_cast<FloatList<float> *>(pack[0]);
-        DatasetColumn<T> * values = reinterpret_cast<DatasetColumn<T> *>(pack[1]);
-        int sortedIndexI = static_cast<int>(sortedIndex->valueAtIndex(i));
-        int sortedIndexJ = static_cast<int>(sortedIndex->valueAtIndex(j));
-        return std::isnan(values->valueAtIndex(sortedIndexI)) || values->valueAtIndex(sortedIndexI) >= values->valueAtIndex(sortedIndexJ);
-      },
-      pack,
-      datasetLength());
-  m_sortedIndex = sortedIndexes;
+  if (hasNativeSortedIndex()) {
+    m_sortedIndex = FloatList<float>();
+    for (int i = 0; i < datasetLength(); i++) {
+      m_nativeSortedIndex[i] = i;
+    }
+    void * pack[] = {m_nativeSortedIndex, const_cast<DatasetColumn<T> *>(m_values)};
+    Helpers::Sort(
+        [](int i, int j, void * ctx, int n) { // swap
+          void ** pack = reinterpret_cast<void **>(ctx);
+          uint8_t * sortedIndex = reinterpret_cast<uint8_t *>(pack[0]);
+          uint8_t temp = sortedIndex[i];
+          sortedIndex[i] = sortedIndex[j];
+          sortedIndex[j] = temp;
+        },
+        [](int i, int j, void * ctx, int n) { // compare
+          void ** pack = reinterpret_cast<void **>(ctx);
+          uint8_t * sortedIndex = reinterpret_cast<uint8_t *>(pack[0]);
+          DatasetColumn<T> * values = reinterpret_cast<DatasetColumn<T> *>(pack[1]);
+          T valueI = values->valueAtIndex(sortedIndex[i]);
+          return std::isnan(valueI) || valueI >= values->valueAtIndex(sortedIndex[j]);
+        },
+        pack,
+        datasetLength());
+  } else {
+    FloatList<float> sortedIndexes = FloatList<float>::Builder();
+    for (int i = 0; i < datasetLength(); i++) {
+      sortedIndexes.addValueAtIndex(static_cast<float>(i), i);
+    }
+    void * pack[] = {&sortedIndexes, const_cast<DatasetColumn<T> *>(m_values)};
+    Helpers::Sort(
+        [](int i, int j, void * ctx, int n) { // swap
+          void ** pack = reinterpret_cast<void **>(ctx);
+          FloatList<float> * sortedIndex = reinterpret_cast<FloatList<float> *>(pack[0]);
+          float temp = sortedIndex->valueAtIndex(i);
+          sortedIndex->replaceValueAtIndex(sortedIndex->valueAtIndex(j), i);
+          sortedIndex->replaceValueAtIndex(temp, j);
+        },
+        [](int i, int j, void * ctx, int n) { // compare
+          void ** pack = reinterpret_cast<void **>(ctx);
+          FloatList<float> * sortedIndex = reinterpret_cast<FloatList<float> *>(pack[0]);
+          DatasetColumn<T> * values = reinterpret_cast<DatasetColumn<T> *>(pack[1]);
+          int sortedIndexI = static_cast<int>(sortedIndex->valueAtIndex(i));
+          int sortedIndexJ = static_cast<int>(sortedIndex->valueAtIndex(j));
+          return std::isnan(values->valueAtIndex(sortedIndexI)) || values->valueAtIndex(sortedIndexI) >= values->valueAtIndex(sortedIndexJ);
+        },
+        pack,
+        datasetLength());
+    m_sortedIndex = sortedIndexes;
+  }
   m_recomputeSortedIndex = false;
 }
 
@@ -16,7 +16,7 @@ TreePool * TreePool::SharedStaticPool = nullptr;
 
 void TreePool::freeIdentifier(uint16_t identifier) {
   if (TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes) {
-    m_nodeForIdentifierOffset[identifier] = UINT16_MAX;
+    m_nodeForIdentifierOffset[identifier] = k_noNodeOffset;
     m_identifiers.push(identifier);
   }
 }
@@ -169,7 +169,7 @@ void TreePool::registerNode(TreeNode * node) {
   uint16_t nodeID = node->identifier();
   assert(nodeID < MaxNumberOfNodes);
   const int nodeOffset = (((char *)node) - (char *)m_alignedBuffer)/ByteAlignment;
-  assert(nodeOffset < k_maxNodeOffset); // Check that the offset can be stored in a uint16_t
+  assert(nodeOffset < k_maxNodeOffset); // Check that the offset can be stored in a NodeOffset
   m_nodeForIdentifierOffset[nodeID] = nodeOffset;
 }
 
@@ -222,9 +222,9 @@ void TreePool::IdentifierStack::remove(uint16_t j) {
 }
 
 // Reset m_nodeForIdentifierOffset for all available identifiers
-void TreePool::IdentifierStack::resetNodeForIdentifierOffsets(uint16_t * nodeForIdentifierOffset) const {
+void TreePool::IdentifierStack::resetNodeForIdentifierOffsets(NodeOffset * nodeForIdentifierOffset) const {
   for (uint16_t i = 0; i < m_currentIndex; i++) {
-    nodeForIdentifierOffset[m_availableIdentifiers[i]] = UINT16_MAX;
+    nodeForIdentifierOffset[m_availableIdentifiers[i]] = k_noNodeOffset;
   }
 }
 
@@ -8,6 +8,7 @@
 namespace Poincare {
 
 constexpr int
+  Zoom::k_evaluationBatchSize,
   Zoom::k_peakNumberOfPointsOfInterest,
   Zoom::k_sampleSize;
 constexpr float
@@ -194,7 +195,7 @@ void Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
   *yMax = resultYMax;
 }
 
-void Zoom::RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float xMin, float xMax, float * yMin, float * yMax, Context * context, const void * auxiliary) {
+void Zoom::RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float xMin, float xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation) {
   /* This methods computes the Y range that will be displayed for cartesian
    * functions and sequences, given an X range (xMin, xMax) and bounds yMin and
    * yMax that must be inside the Y range.*/
@@ -202,21 +203,26 @@ void Zoom::RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float xMin, float
 
   float sampleYMin = FLT_MAX, sampleYMax = -FLT_MAX;
   const float step = (xMax - xMin) / (k_sampleSize - 1);
-  float x, y;
+  float x[k_evaluationBatchSize], y[k_evaluationBatchSize];
   float sum = 0.f;
   int pop = 0;
 
-  for (int i = 1; i < k_sampleSize - 1; i++) {
-    x = xMin + i * step;
-    y = evaluation(x, context, auxiliary);
-    if (!std::isfinite(y)) {
-      continue;
+  for (int i = 1; i < k_sampleSize - 1; i += k_evaluationBatchSize) {
+    int n = std::min(k_evaluationBatchSize, k_sampleSize - 1 - i);
+    for (int j = 0; j < n; j++) {
+      x[j] = xMin + (i + j) * step;
     }
-    sampleYMin = std::min(sampleYMin, y);
-    sampleYMax = std::max(sampleYMax, y);
-    if (y != 0.f) {
-      sum += std::log(std::fabs(y));
-      pop++;
+    EvaluateAtAbscissas(evaluation, batchEvaluation, x, y, n, context, auxiliary);
+    for (int j = 0; j < n; j++) {
+      if (!std::isfinite(y[j])) {
+        continue;
+      }
+      sampleYMin = std::min(sampleYMin, y[j]);
+      sampleYMax = std::max(sampleYMax, y[j]);
+      if (y[j] != 0.f) {
+        sum += std::log(std::fabs(y[j]));
+        pop++;
+      }
     }
   }
 
@@ -242,7 +248,7 @@ void Zoom::RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float xMin, float
   }
 }
 
-void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float xMin, float xMax, float yMinForced, float yMaxForced, float * yMin, float * yMax, Context * context, const void * auxiliary) {
+void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float xMin, float xMax, float yMinForced, float yMaxForced, float * yMin, float * yMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation) {
   /* The goal of this algorithm is to find the window with given ratio, that
    * best suits the function.
    * - The X range is centered around a point of interest of the function, or
@@ -256,23 +262,16 @@ void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, f
   float xRange = xMax - xMin;
   float step = xRange / (sampleSize - 1);
   float sample[sampleSize];
-  for (int i = 0; i < sampleSize; i++) {
-    sample[i] = evaluation(xMin + i * step, context, auxiliary);
+  float x[k_evaluationBatchSize];
+  for (int i = 0; i < sampleSize; i += k_evaluationBatchSize) {
+    int n = std::min(k_evaluationBatchSize, sampleSize - i);
+    for (int j = 0; j < n; j++) {
+      x[j] = xMin + (i + j) * step;
+    }
+    EvaluateAtAbscissas(evaluation, batchEvaluation, x, sample + i, n, context, auxiliary);
   }
-  Helpers::Sort(
-      [](int i, int j, void * ctx, int size) {
-        float * array = static_cast<float *>(ctx);
-        float temp = array[i];
-        array[i] = array[j];
-        array[j] = temp;
-      },
-      [](int i, int j, void * ctx, int size) {
-        float * array = static_cast<float *>(ctx);
-        // NaN are expected at the end of the list
-        return array[i] >= array[j] || std::isnan(array[i]);
-      },
-      sample,
-      sampleSize);
+  // NaN are expected at the end of the list
+  Helpers::Sort(sample, sampleSize, true);
 
   /* For each value taken by the sample of the function on [xMin, xMax], given
    * a fixed value for yRange, we measure the number (referred to as breadth)
@@ -328,7 +327,7 @@ void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, f
   *yMax = yCenter + yRange / 2.f;
 }
 
-void Zoom::ExpandSparseWindow(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary) {
+void Zoom::ExpandSparseWindow(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation) {
   /* We compute the "empty center" of the window, i.e. the largest rectangle
    * (with same center and shape as the window) that does not contain any
    * point. If that rectangle is deemed too large, we consider that not enough
@@ -344,16 +343,22 @@ void Zoom::ExpandSparseWindow(ValueAtAbscissa evaluation, float * xMin, float *
   float emptyCenter = FLT_MAX;
   float step = xRange / (k_sampleSize - 1);
   int n = 0;
-  for (int i = 0; i < k_sampleSize; i++) {
-    float x = *xMin + i * step;
-    float y = evaluation(x, context, auxiliary);
-    if (std::isfinite(y)) {
-      n++;
-      /* r is the ratio between the window and the largest rectangle (with same
-       * center and shape as the window) that does not contain (x,y).
-       * i.e. the smallest zoom-in for which (x,y) is not visible. */
-      float r = 2 * std::max(std::fabs(x - xCenter) / xRange, std::fabs(y - yCenter) / yRange);
-      emptyCenter = std::min(emptyCenter, r);
+  float x[k_evaluationBatchSize], y[k_evaluationBatchSize];
+  for (int i = 0; i < k_sampleSize; i += k_evaluationBatchSize) {
+    int batchSize = std::min(k_evaluationBatchSize, k_sampleSize - i);
+    for (int j = 0; j < batchSize; j++) {
+      x[j] = *xMin + (i + j) * step;
+    }
+    EvaluateAtAbscissas(evaluation, batchEvaluation, x, y, batchSize, context, auxiliary);
+    for (int j = 0; j < batchSize; j++) {
+      if (std::isfinite(y[j])) {
+        n++;
+        /* r is the ratio between the window and the largest rectangle (with
+         * same center and shape as the window) that does not contain (x,y).
+         * i.e. the smallest zoom-in for which (x,y) is not visible. */
+        float r = 2 * std::max(std::fabs(x[j] - xCenter) / xRange, std::fabs(y[j] - yCenter) / yRange);
+        emptyCenter = std::min(emptyCenter, r);
+      }
     }
   }
 
@@ -362,17 +367,24 @@ void Zoom::ExpandSparseWindow(ValueAtAbscissa evaluation, float * xMin, float *
   }
 }
 
-void Zoom::FullRange(ValueAtAbscissa evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary) {
+void Zoom::FullRange(ValueAtAbscissa evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary, ValuesAtAbscissas batchEvaluation) {
   float t = tMin;
   *fMin = FLT_MAX;
   *fMax = -FLT_MAX;
+  float ts[k_evaluationBatchSize], values[k_evaluationBatchSize];
   while (t <= tMax) {
-    float value = evaluation(t, context, auxiliary);
-    if (std::isfinite(value)) {
-      *fMin = std::min(*fMin, value);
-      *fMax = std::max(*fMax, value);
+    int n = 0;
+    while (t <= tMax && n < k_evaluationBatchSize) {
+      ts[n++] = t;
+      t += tStep;
+    }
+    EvaluateAtAbscissas(evaluation, batchEvaluation, ts, values, n, context, auxiliary);
+    for (int i = 0; i < n; i++) {
+      if (std::isfinite(values[i])) {
+        *fMin = std::min(*fMin, values[i]);
+        *fMax = std::max(*fMax, values[i]);
+      }
     }
-    t += tStep;
   }
   if (*fMin > *fMax) {
     *fMin = NAN;
@@ -461,6 +473,17 @@ bool Zoom::IsConvexAroundExtremum(ValueAtAbscissa evaluation, float x1, float x2
   return true;
 }
 
+void Zoom::EvaluateAtAbscissas(ValueAtAbscissa evaluation, ValuesAtAbscissas batchEvaluation, const float * x, float * y, int n, Context * context, const void * auxiliary) {
+  assert(n <= k_evaluationBatchSize);
+  if (batchEvaluation) {
+    batchEvaluation(x, y, n, context, auxiliary);
+    return;
+  }
+  for (int i = 0; i < n; i++) {
+    y[i] = evaluation(x[i], context, auxiliary);
+  }
+}
+
 bool Zoom::DoesNotOverestimatePrecision(float dx, float y1, float y2, float y3) {
   /* The float type looses precision surprisingly fast, and cannot confidently
    * hold more than 6.6 digits of precision. Results more precise than that are
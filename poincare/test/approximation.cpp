@@ -144,6 +144,10 @@ QUIZ_CASE(poincare_approximation_multiplication) {
   assert_expression_approximates_to<double>("{1,2,3}×{4,5,6}", "{4,10,18}");
   assert_expression_approximates_to<double>("{1,2,3}×{4,5}", Undefined::Name());
   assert_expression_approximates_to<double>("{1,2,3}×[[4,5,6]]", Undefined::Name());
+  assert_expression_approximates_to<float>("[[1,2,3][4,5,6]]×[[1,2][3,4][5,6]]", "[[22,28][49,64]]");
+  assert_expression_approximates_to<double>("[[1,2,3][4,5,6]]×[[1,2][3,4][5,6]]", "[[22,28][49,64]]");
+  assert_expression_approximates_to<double>("[[1,2,3][4,5,6]]×[[1,2][3,4]]", Undefined::Name());
+  assert_expression_approximates_to<double>("trace([[1][2][3][4][5][6][7][8][9][10][11]]×[[1,2,3,4,5,6,7,8,9,10,11]])", "506");
 
   assert_expression_approximates_to_scalar<float>("1×2", 2.0f);
   assert_expression_approximates_to_scalar<double>("(3+i)×(4+i)", NAN);
@@ -194,6 +198,15 @@ QUIZ_CASE(poincare_approximation_power) {
   assert_expression_approximates_to_scalar<float>("2^3", 8.0f);
   assert_expression_approximates_to_scalar<double>("(3+i)^(4+i)", NAN);
   assert_expression_approximates_to_scalar<float>("[[1,2][3,4]]^2", NAN);
+  assert_expression_approximates_to<double>("[[1,2][3,4]]^5", "[[1069,1558][2337,3406]]");
+  assert_expression_approximates_to<float>("[[1,2][3,4]]^0", "[[1,0][0,1]]");
+  assert_expression_approximates_to<double>("[[1,1][0,1]]^1000", "[[1,1000][0,1]]");
+  assert_expression_approximates_to<double>("[[2,0][0,4]]^(-3)", "[[0.125,0][0,0.015625]]");
+  assert_expression_approximates_to<double>("[[1,2][2,4]]^(-1)", Undefined::Name());
+  assert_expression_approximates_to<double>("[[1,2,3][4,5,6]]^2", Undefined::Name());
+  // Matrices with more coefficients than Matrix::k_maxNumberOfCoefficients
+  assert_expression_approximates_to<double>("trace(identity(11)^3)", "11");
+  assert_expression_approximates_to<double>("identity(11)^(-1)", Undefined::Name());
 
 
   assert_expression_approximates_to<float>("(-10)^0.00000001", "nonreal", Radian, MetricUnitFormat, Real);
@@ -475,6 +488,8 @@ QUIZ_CASE(poincare_approximation_function) {
 
   assert_expression_approximates_to<float>("inverse([[1,2,3][4,5,-6][7,8,9]])", "[[-1.2917,-0.083333,0.375][1.0833,0.16667,-0.25][0.041667,-0.083333,0.041667]]", Degree, MetricUnitFormat, Cartesian, 5); // inverse is not precise enough to display 7 significative digits
   assert_expression_approximates_to<double>("inverse([[1,2,3][4,5,-6][7,8,9]])", "[[-1.2916666666667,-0.083333333333333,0.375][1.0833333333333,0.16666666666667,-0.25][0.041666666666667,-0.083333333333333,0.041666666666667]]");
+  // A tiny first pivot is not used to eliminate the other rows
+  assert_expression_approximates_to<double>("inverse([[1ᴇ-20,1][1,1]])", "[[-1,1][1,-1ᴇ-20]]");
   assert_expression_approximates_to<float>("inverse([[i,23-2i,3×i][4+i,5×i,6][7,8×i+2,9]])", "[[-0.0118-0.0455×i,-0.5-0.727×i,0.318+0.489×i][0.0409+0.00364×i,0.04-0.0218×i,-0.0255+9.1ᴇ-4×i][0.00334-0.00182×i,0.361+0.535×i,-0.13-0.358×i]]", Degree, MetricUnitFormat, Cartesian, 3); // inverse is not precise enough to display 7 significative digits
   assert_expression_approximates_to<double>("inverse([[i,23-2i,3×i][4+i,5×i,6][7,8×i+2,9]])", "[[-0.0118289353958-0.0454959053685×i,-0.500454959054-0.727024567789×i,0.31847133758+0.488626023658×i][0.0409463148317+0.00363967242948×i,0.0400363967243-0.0218380345769×i,-0.0254777070064+9.0991810737ᴇ-4×i][0.00333636639369-0.00181983621474×i,0.36093418259+0.534728541098×i,-0.130118289354-0.357597816197×i]]", Degree, MetricUnitFormat, Cartesian, 12); // FIXME: inverse is not precise enough to display 14 significative digits
 
@@ -1075,6 +1090,14 @@ QUIZ_CASE(poincare_approximation_map_on_list) {
   assert_expression_approximates_to<float>("sin({0,π})", "{0,0}", Radian);
   assert_expression_approximates_to<float>("{2,3.4}-{0.1,3.1}", "{1.9,0.3}");
   assert_expression_approximates_to<float>("tan({0,π/4})", "{0,1}", Radian);
+
+  // Lists longer than the chunks they are read and built by
+  assert_expression_approximates_to<double>("sequence(k,k,18)+1", "{2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19}");
+  assert_expression_approximates_to<double>("{1,undef,3}+{1,2,3}", "{2,undef,6}");
+  assert_expression_approximates_to_scalar<double>("mean(sequence(k,k,40)+sequence(2k,k,40))", 61.5);
+  assert_expression_approximates_to_scalar<double>("mean(abs(sequence(-k,k,40)))", 20.5);
+  assert_expression_approximates_to_scalar<double>("mean(round(sequence(k+0.12,k,40),1))", 20.6);
+  assert_expression_approximates_to<float>("2^sequence(k,k,17)", "{2,4,8,16,32,64,128,256,512,1024,2048,4096,8192,16384,32768,65536,131072}");
 }
 
 QUIZ_CASE(poincare_approximation_probability) {
@@ -1148,6 +1171,24 @@ QUIZ_CASE(poincare_approximation_store) {
   Ion::Storage::FileSystem::sharedFileSystem()->recordNamed("f.func").destroy();
 }
 
+QUIZ_CASE(poincare_approximation_store_redefinition) {
+  // The context must not keep using previous definitions of a and f
+  Shared::GlobalContext globalContext;
+  assert_reduce("2→a");
+  assert_reduce("a×x+1→f(x)");
+  Expression e = parse_expression("f(a)+a", &globalContext, false);
+  quiz_assert(e.approximateToScalar<double>(&globalContext, Cartesian, Radian) == 7.0);
+  assert_reduce("3→a");
+  quiz_assert(e.approximateToScalar<double>(&globalContext, Cartesian, Radian) == 13.0);
+  assert_reduce("x-a→f(x)");
+  quiz_assert(e.approximateToScalar<double>(&globalContext, Cartesian, Radian) == 3.0);
+
+  // Clean the storage for other tests
+  Ion::Storage::FileSystem::sharedFileSystem()->recordNamed("a.exp").destroy();
+  Ion::Storage::FileSystem::sharedFileSystem()->recordNamed("f.func").destroy();
+  quiz_assert(std::isnan(e.approximateToScalar<double>(&globalContext, Cartesian, Radian)));
+}
+
 QUIZ_CASE(poincare_approximation_store_matrix) {
   assert_expression_approximates_to<double>("[[7]]→a", "[[7]]");
 
@@ -1323,6 +1364,9 @@ QUIZ_CASE(poincare_approximation_lists_functions) {
   assert_expression_approximates_to_scalar<double>("med({1,6,3,5,2})", 3.);
   assert_expression_approximates_to_scalar<double>("med({1,6,3,4,5,2})", 3.5);
   assert_expression_approximates_to_scalar<double>("med({1,6,3,4,5,2},{2,3,0.1,2.8,3,1})", 5.);
+  // Datasets longer than 256 elements keep their sorted indexes in the pool
+  assert_expression_approximates_to_scalar<double>("med(sequence(201-k,k,200))", 100.5);
+  assert_expression_approximates_to_scalar<double>("med(sequence(301-k,k,300))", 150.5);
   assert_expression_approximates_to<double>("med({1,undef,6,3,5,undef,2})", Undefined::Name());
   assert_expression_approximates_to_scalar<double>("var({1,2,3,4,5,6})", 2.916666666666666);
   assert_expression_approximates_to<double>("var({1,2,3,undef,4,5,6})", Undefined::Name());
@@ -0,0 +1,70 @@
+#include <poincare/compiled_expression.h>
+#include <poincare/expression.h>
+#include <apps/shared/global_context.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+template <typename T>
+void assert_compiled_expression_approximates_as_tree(Expression e, CompiledExpression * compiled, T x, Context * context, Preferences::AngleUnit angleUnit) {
+  T expected = e.approximateWithValueForSymbol<T>("x", x, context, Real, angleUnit);
+  T result;
+  if (compiled->approximateWithValueForSymbol<T>(x, &result)) {
+    quiz_assert_log_if_failure(result == expected || (std::isnan(result) && std::isnan(expected)), e);
+  }
+}
+
+void assert_reduced_expression_compiles_as_tree(const char * expression, bool compiles = true, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false).cloneAndReduce(ExpressionNode::ReductionContext(&context, Real, angleUnit, MetricUnitFormat, SystemForApproximation));
+  CompiledExpression compiled;
+  quiz_assert_print_if_failure(compiled.compile(e, "x", &context, Real, angleUnit) == compiles, expression);
+  if (!compiles) {
+    quiz_assert_print_if_failure(!compiled.isCompiled(), expression);
+    return;
+  }
+  constexpr int k_numberOfValues = 9;
+  const double values[k_numberOfValues] = {-10.0, -2.5, -1.0, -0.3, 0.0, 0.7, 1.0, 3.0, 1.5e3};
+  double results[k_numberOfValues];
+  e.approximateWithValuesForSymbol<double>("x", values, results, k_numberOfValues, &context, Real, angleUnit);
+  for (int i = 0; i < k_numberOfValues; i++) {
+    assert_compiled_expression_approximates_as_tree<float>(e, &compiled, static_cast<float>(values[i]), &context, angleUnit);
+    assert_compiled_expression_approximates_as_tree<double>(e, &compiled, values[i], &context, angleUnit);
+    double expected = e.approximateWithValueForSymbol<double>("x", values[i], &context, Real, angleUnit);
+    quiz_assert_print_if_failure(results[i] == expected || (std::isnan(results[i]) && std::isnan(expected)), expression);
+  }
+}
+
+QUIZ_CASE(poincare_compiled_expression) {
+  assert_reduced_expression_compiles_as_tree("x");
+  assert_reduced_expression_compiles_as_tree("3");
+  assert_reduced_expression_compiles_as_tree("x^2-3x+π");
+  assert_reduced_expression_compiles_as_tree("1/x");
+  assert_reduced_expression_compiles_as_tree("√(x)");
+  assert_reduced_expression_compiles_as_tree("x^(1/3)");
+  assert_reduced_expression_compiles_as_tree("x^(2/3)+x^(3/2)");
+  assert_reduced_expression_compiles_as_tree("e^x");
+  assert_reduced_expression_compiles_as_tree("2^x");
+  assert_reduced_expression_compiles_as_tree("x^x");
+  assert_reduced_expression_compiles_as_tree("ln(x)");
+  assert_reduced_expression_compiles_as_tree("log(x)");
+  assert_reduced_expression_compiles_as_tree("abs(x-1)");
+  assert_reduced_expression_compiles_as_tree("sin(x)+cos(2x)");
+  assert_reduced_expression_compiles_as_tree("tan(x)");
+  assert_reduced_expression_compiles_as_tree("sin(x)", true, Degree);
+  assert_reduced_expression_compiles_as_tree("tan(45x)", true, Gradian);
+  assert_reduced_expression_compiles_as_tree("x*ln(x)/(x^2+1)");
+  assert_reduced_expression_compiles_as_tree("random()*x", false);
+  assert_reduced_expression_compiles_as_tree("floor(x)", false);
+  assert_reduced_expression_compiles_as_tree("[[x]]", false);
+
+  Shared::GlobalContext context;
+  CompiledExpression compiled;
+  quiz_assert(!compiled.compile(Expression(), "x", &context, Real, Radian));
+  quiz_assert(!compiled.compile(parse_expression("x+1", &context, false), "x", &context, Cartesian, Radian));
+  quiz_assert(compiled.compile(parse_expression("x+1", &context, false), "x", &context, Real, Radian));
+  double result;
+  quiz_assert(compiled.approximateWithValueForSymbol<double>(2.0, &result) && result == 3.0);
+  compiled.clear();
+  quiz_assert(!compiled.isCompiled());
+}
@@ -106,3 +106,83 @@ QUIZ_CASE(poincare_helpers_rotate) {
     }
   }
 }
+
+struct SortPair {
+  int key;
+  int order;
+};
+
+static int s_numberOfComparisons;
+
+static void swap_pairs(int i, int j, void * context, int numberOfElements) {
+  SortPair * pairs = static_cast<SortPair *>(context);
+  SortPair t = pairs[i];
+  pairs[i] = pairs[j];
+  pairs[j] = t;
+}
+
+static bool compare_pairs_lenient(int i, int j, void * context, int numberOfElements) {
+  SortPair * pairs = static_cast<SortPair *>(context);
+  s_numberOfComparisons++;
+  return pairs[i].key >= pairs[j].key;
+}
+
+static bool compare_pairs_strict(int i, int j, void * context, int numberOfElements) {
+  SortPair * pairs = static_cast<SortPair *>(context);
+  s_numberOfComparisons++;
+  return pairs[i].key > pairs[j].key;
+}
+
+static void assert_sort_keeps_insertion_order(int * keys, int numberOfElements, bool lenient) {
+  constexpr int k_maxNumberOfElements = 500;
+  assert(numberOfElements <= k_maxNumberOfElements);
+  SortPair pairs[k_maxNumberOfElements];
+  for (int i = 0; i < numberOfElements; i++) {
+    pairs[i] = {keys[i], i};
+  }
+  s_numberOfComparisons = 0;
+  Poincare::Helpers::Sort(swap_pairs, lenient ? compare_pairs_lenient : compare_pairs_strict, pairs, numberOfElements);
+  // A lenient comparison keeps equal keys in order, a strict one reverses them
+  for (int i = 1; i < numberOfElements; i++) {
+    quiz_assert(pairs[i - 1].key < pairs[i].key || (pairs[i - 1].key == pairs[i].key && (pairs[i - 1].order < pairs[i].order) == lenient));
+  }
+}
+
+QUIZ_CASE(poincare_helpers_sort) {
+  constexpr int numberOfElements = 500;
+  int keys[numberOfElements];
+  for (int i = 0; i < numberOfElements; i++) {
+    keys[i] = numberOfElements - i;
+  }
+  assert_sort_keeps_insertion_order(keys, numberOfElements, true);
+  // A reversed list is not sorted in quadratic time
+  quiz_assert(s_numberOfComparisons < 10 * numberOfElements);
+  assert_sort_keeps_insertion_order(keys, numberOfElements, false);
+
+  uint32_t seed = 12345;
+  for (int length : {0, 1, 2, 15, 16, 17, 33, 100, numberOfElements}) {
+    for (int i = 0; i < length; i++) {
+      seed = seed * 1103515245 + 12345;
+      keys[i] = (seed >> 16) % 20;
+    }
+    assert_sort_keeps_insertion_order(keys, length, true);
+    assert_sort_keeps_insertion_order(keys, length, false);
+  }
+}
+
+QUIZ_CASE(poincare_helpers_sort_values) {
+  constexpr int numberOfElements = 8;
+  float values[numberOfElements] = {3.0f, NAN, -1.0f, 2.0f, INFINITY, NAN, 3.0f, -INFINITY};
+  float sorted[numberOfElements] = {-INFINITY, -1.0f, 2.0f, 3.0f, 3.0f, INFINITY, NAN, NAN};
+  Poincare::Helpers::Sort(values, numberOfElements);
+  for (int i = 0; i < numberOfElements; i++) {
+    quiz_assert(values[i] == sorted[i] || (std::isnan(values[i]) && std::isnan(sorted[i])));
+  }
+
+  double doubles[numberOfElements] = {NAN, 5.0, 1.0, NAN, 0.0, -2.0, 1.0, 7.0};
+  double sortedDoubles[numberOfElements] = {NAN, NAN, -2.0, 0.0, 1.0, 1.0, 5.0, 7.0};
+  Poincare::Helpers::Sort(doubles, numberOfElements, false);
+  for (int i = 0; i < numberOfElements; i++) {
+    quiz_assert(doubles[i] == sortedDoubles[i] || (std::isnan(doubles[i]) && std::isnan(sortedDoubles[i])));
+  }
+}
@@ -158,6 +158,12 @@ QUIZ_CASE(poincare_integer_multiplication) {
   assert_mult_to(Integer("-23456787654567765456"), Integer("0"), Integer("0"));
   assert_mult_to(Integer("3293920983030066"), Integer(720), Integer("2371623107781647520"));
   assert_mult_to(Integer("389282362616"), Integer(720), Integer("280283301083520"));
+  // Operands of 16 digits and more
+  assert_mult_to(Integer("477311073811304114486478503581164406916224853039238513850085608145771986880516808459166772134240378240755073828170296740373082348622309614668344831750401"), Integer("131113437138048251322711480597803215332101201774990516815131689813892946509380556272605041597969860106905820222554291655201459120130455805408840262508001"), Integer("62581895471452730979179887000478680575366196559884690818731046053712225738796328487751229537466482817134578859209960023097996440421807062588500745722310340649310481454484362612776938812765450710320201820012136955046408342197322747159654999015621845923671540506302080170024186239315172208118706319097458401"));
+  assert_mult_to(Integer("-1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000012345678901234567890123"), Integer("10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000987654321"), Integer("-10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000123456789013333333222230000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000012193263112482853211247834171483"));
+  Integer i("13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084095"); // 2^512-1
+  assert_mult_to(i, i, Integer("179769313486231590772930519078902473361797697894230657273430081157732675805500963132708477322407536021120113879871393357658789768814416622492847430639474097562152033539671286128252223189553839160721441767298250321715263238814402734379959506792230903356495130620869925267845538430714092411695463462326211969025"));
+  quiz_assert(Integer::Multiplication(i, Integer::Multiplication(i, Integer(2))).isOverflow());
 }
 
 static inline void assert_div_to(const Integer i, const Integer j, const Integer q, const Integer r) {
@@ -201,6 +207,9 @@ QUIZ_CASE(poincare_integer_pow) {
   assert_pow_to(Integer(2), Integer(2), Integer(4));
   assert_pow_to(Integer("12345678910111213141516171819202122232425"), Integer(2), Integer("152415787751564791571474464067365843004067618915106260955633159458990465721380625"));
   assert_pow_to(Integer(14), Integer(14), Integer("11112006825558016"));
+  assert_pow_to(Integer(-3), Integer(641), Integer("-683477583548700613463778489762626610605309935069284108665119675984823063931557247793753952349429324482377133675619926658920120551377370014033572687771115001129733188208674848144454107801757127965326947191738336753085157070585198321285953595412049793700854884390274460101058805062264386313699461852690982403"));
+  quiz_assert(Integer::Power(Integer(2), Integer(1024)).isOverflow());
+  quiz_assert(Integer::Power(Integer(2), Integer("4294967296")).isOverflow());
 }
 
 static inline void assert_factorial_to(const Integer i, const Integer j) {
@@ -208,7 +217,13 @@ static inline void assert_factorial_to(const Integer i, const Integer j) {
 }
 
 QUIZ_CASE(poincare_integer_factorial) {
+  assert_factorial_to(Integer(0), Integer(1));
+  assert_factorial_to(Integer(1), Integer(1));
   assert_factorial_to(Integer(5), Integer(120));
+  assert_factorial_to(Integer(170), Integer("7257415615307998967396728211129263114716991681296451376543577798900561843401706157852350749242617459511490991237838520776666022565442753025328900773207510902400430280058295603966612599658257104398558294257568966313439612262571094946806711205568880457193340212661452800000000000000000000000000000000000000000"));
+  quiz_assert(Integer::Factorial(Integer(171)).isOverflow());
+  quiz_assert(Integer::Factorial(Integer("4294967295")).isOverflow());
+  quiz_assert(Integer::Factorial(Integer("4294967296")).isOverflow());
   assert_factorial_to(Integer(123), Integer("12146304367025329675766243241881295855454217088483382315328918161829235892362167668831156960612640202170735835221294047782591091570411651472186029519906261646730733907419814952960000000000000000000000000000"));
 }
 
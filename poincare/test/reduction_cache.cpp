@@ -0,0 +1,54 @@
+#include <poincare/reduction_cache.h>
+#include <poincare/rational.h>
+#include <apps/shared/global_context.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+void assert_reduces_identically_from_cache(const char * expression, Preferences::AngleUnit angleUnit = Radian, Preferences::ComplexFormat complexFormat = Cartesian) {
+  Shared::GlobalContext context;
+  ExpressionNode::ReductionContext reductionContext(&context, complexFormat, angleUnit, MetricUnitFormat, User);
+  Expression e = parse_expression(expression, &context, false);
+  quiz_assert_print_if_failure(ReductionCache::IsCacheable(e, &context), expression);
+  ReductionCache::SharedCache()->clear();
+  Expression reduced = e.cloneAndReduce(reductionContext);
+  Expression cached = ReductionCache::SharedCache()->reducedExpression(e, reductionContext);
+  quiz_assert_print_if_failure(!cached.isUninitialized() && cached.isIdenticalTo(reduced), expression);
+  quiz_assert_print_if_failure(e.cloneAndReduce(reductionContext).isIdenticalTo(reduced), expression);
+}
+
+QUIZ_CASE(poincare_reduction_cache) {
+  assert_reduces_identically_from_cache("1+2");
+  assert_reduces_identically_from_cache("cos(π/4)×√(8)");
+  assert_reduces_identically_from_cache("cos(90)", Degree);
+  assert_reduces_identically_from_cache("√(-4)", Radian, Real);
+  assert_reduces_identically_from_cache("[[1,2][3,4]]^(-1)");
+  assert_reduces_identically_from_cache("cross([[1,2,3]],[[4,7,8]])");
+  assert_reduces_identically_from_cache("{1,2,3}×2");
+  assert_reduces_identically_from_cache("3_km+200_m");
+
+  Shared::GlobalContext context;
+  quiz_assert(!ReductionCache::IsCacheable(parse_expression("x+1", &context, false), &context));
+  quiz_assert(!ReductionCache::IsCacheable(parse_expression("f(2)", &context, false), &context));
+  quiz_assert(!ReductionCache::IsCacheable(parse_expression("random()+1", &context, false), &context));
+  quiz_assert(!ReductionCache::IsCacheable(parse_expression("3→a", &context, false), &context));
+
+  // Entries are told apart by their input and their reduction context
+  ReductionCache * cache = ReductionCache::SharedCache();
+  cache->clear();
+  ExpressionNode::ReductionContext radianContext(&context, Cartesian, Radian, MetricUnitFormat, User);
+  ExpressionNode::ReductionContext degreeContext(&context, Cartesian, Degree, MetricUnitFormat, User);
+  Expression e = parse_expression("1+1", &context, false);
+  cache->storeReducedExpression(e, radianContext, Rational::Builder(3));
+  quiz_assert(cache->reducedExpression(e, radianContext).isIdenticalTo(Rational::Builder(3)));
+  quiz_assert(cache->reducedExpression(e, degreeContext).isUninitialized());
+  quiz_assert(cache->reducedExpression(parse_expression("1+2", &context, false), radianContext).isUninitialized());
+  quiz_assert(cache->reducedExpression(parse_expression("(1+1)", &context, false), radianContext).isUninitialized());
+  // The simplification order ignores matrix dimensions
+  Expression row = parse_expression("[[1,2]]", &context, false);
+  cache->storeReducedExpression(row, radianContext, row.clone());
+  quiz_assert(!cache->reducedExpression(row, radianContext).isUninitialized());
+  quiz_assert(cache->reducedExpression(parse_expression("[[1][2]]", &context, false), radianContext).isUninitialized());
+  cache->clear();
+  quiz_assert(cache->reducedExpression(e, radianContext).isUninitialized());
+}
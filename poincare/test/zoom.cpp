@@ -34,6 +34,11 @@ float evaluate_expression(float x, Context * context, const void * auxiliary) {
   return pack->expression().approximateWithValueForSymbol<float>(pack->symbol(), x, context, Real, pack->angleUnit());
 }
 
+void evaluate_expression_at_abscissas(const float * x, float * y, int n, Context * context, const void * auxiliary) {
+  const ParametersPack * pack = static_cast<const ParametersPack *>(auxiliary);
+  pack->expression().approximateWithValuesForSymbol<float>(pack->symbol(), x, y, n, context, Real, pack->angleUnit());
+}
+
 bool range1D_matches(float min, float max, float targetMin, float targetMax, float tolerance = StandardTolerance) {
   return (roughly_equal(min, targetMin, tolerance) && roughly_equal(max, targetMax, tolerance))
       || (std::isnan(min) && std::isnan(max) && std::isnan(targetMin) && std::isnan(targetMax));
@@ -98,6 +103,8 @@ void assert_refined_range_is(const char * definition, float xMin, float xMax, fl
   ParametersPack aux(e, symbol, angleUnit);
   Zoom::RefinedYRangeForDisplay(evaluate_expression, xMin, xMax, &yMin, &yMax, &globalContext, &aux);
   quiz_assert_print_if_failure(range1D_matches(yMin, yMax, targetYMin, targetYMax), definition);
+  Zoom::RefinedYRangeForDisplay(evaluate_expression, xMin, xMax, &yMin, &yMax, &globalContext, &aux, evaluate_expression_at_abscissas);
+  quiz_assert_print_if_failure(range1D_matches(yMin, yMax, targetYMin, targetYMax), definition);
 }
 
 QUIZ_CASE(poincare_zoom_refined_range) {
@@ -138,6 +145,8 @@ void assert_orthonormal_range_is(const char * definition, float xMin, float xMax
   ParametersPack aux(e, symbol, angleUnit);
   Zoom::RangeWithRatioForDisplay(evaluate_expression, NormalRatio, xMin, xMax, FLT_MAX, -FLT_MAX, &yMin, &yMax, &globalContext, &aux);
   quiz_assert_print_if_failure(range1D_matches(yMin, yMax, targetYMin, targetYMax), definition);
+  Zoom::RangeWithRatioForDisplay(evaluate_expression, NormalRatio, xMin, xMax, FLT_MAX, -FLT_MAX, &yMin, &yMax, &globalContext, &aux, evaluate_expression_at_abscissas);
+  quiz_assert_print_if_failure(range1D_matches(yMin, yMax, targetYMin, targetYMax), definition);
 }
 
 QUIZ_CASE(poincare_zoom_range_with_ratio) {
@@ -158,6 +167,8 @@ void assert_full_range_is(const char * definition, float xMin, float xMax, float
   ParametersPack aux(e, symbol, angleUnit);
   Zoom::FullRange(&evaluate_expression, xMin, xMax, step, &yMin, &yMax, &globalContext, &aux);
   quiz_assert_print_if_failure(range1D_matches(yMin, yMax, targetYMin, targetYMax), definition);
+  Zoom::FullRange(&evaluate_expression, xMin, xMax, step, &yMin, &yMax, &globalContext, &aux, evaluate_expression_at_abscissas);
+  quiz_assert_print_if_failure(range1D_matches(yMin, yMax, targetYMin, targetYMax), definition);
 }
 
 QUIZ_CASE(poincare_zoom_full_range) {
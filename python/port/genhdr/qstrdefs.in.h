@@ -137,6 +137,7 @@ Q(bound_method)
 Q(builtins)
 Q(bytecode)
 Q(bytes)
+Q(bytearray)
 Q(callable)
 Q(ceil)
 Q(choice)
@@ -370,6 +371,19 @@ Q(KEY_EE)
 Q(KEY_ANS)
 Q(KEY_EXE)
 
+// Native emitter QSTRs
+#if defined(__x86_64__) && defined(__linux__)
+Q(None)
+Q(native)
+Q(viper)
+Q(ViperTypeError)
+Q(uint)
+Q(ptr)
+Q(ptr8)
+Q(ptr16)
+Q(ptr32)
+#endif
+
 // Kandinsky QSTRs
 Q(kandinsky)
 Q(color)
@@ -377,6 +391,9 @@ Q(draw_string)
 Q(fill_rect)
 Q(get_pixel)
 Q(set_pixel)
+Q(blit)
+Q(get_rect)
+Q(set_pixels)
 
 // Matplotlib QSTRs
 Q(arrow)
@@ -5,6 +5,34 @@ extern "C" {
 #include "mphalport.h"
 }
 
+/* Reading the clock is not free either: it is a system call on the simulator.
+ * The hook therefore only reads it once every sCallsBetweenClockChecks calls.
+ * This number is calibrated each time the clock is read so that the clock is
+ * read about every k_clockCheckPeriod ms, which bounds the lag of the display
+ * refresh and of the interruption check.
+ * The calibration is only valid while calls keep the same pace. The number of
+ * calls is therefore capped low, and calls that may take long, such as
+ * drawing, printing or reading the time, make the next call read the clock and
+ * start the calibration over. */
+
+static constexpr uint64_t k_refreshPeriod = 100;
+static constexpr uint64_t k_clockCheckPeriod = 10;
+static constexpr uint32_t k_maxCallsBetweenClockChecks = 1 << 11;
+static uint32_t sCallsBetweenClockChecks = 1;
+static uint32_t sCallsBeforeClockCheck = 1;
+static micropython_port_vm_hook_statistics_t sStatistics;
+
+static void calibrateCallsBetweenClockChecks(uint64_t elapsedTime) {
+  if (elapsedTime < k_clockCheckPeriod / 2) {
+    // Calls are fast: grow cautiously since a slower loop might follow
+    sCallsBetweenClockChecks = sCallsBetweenClockChecks < k_maxCallsBetweenClockChecks ? 2 * sCallsBetweenClockChecks : k_maxCallsBetweenClockChecks;
+  } else if (elapsedTime > k_clockCheckPeriod) {
+    // Calls are slow: shrink at once to keep the refresh on time
+    uint64_t calls = sCallsBetweenClockChecks * k_clockCheckPeriod / elapsedTime;
+    sCallsBetweenClockChecks = calls > 0 ? calls : 1;
+  }
+}
+
 bool micropython_port_vm_hook_loop() {
   /* This function is called very frequently by the MicroPython engine. We grab
    * this opportunity to interrupt execution and/or refresh the display on
@@ -13,18 +41,45 @@ bool micropython_port_vm_hook_loop() {
   /* Doing too many things here slows down Python execution quite a lot. So we
    * only do things once in a while and return as soon as possible otherwise. */
 
+  sStatistics.numberOfCalls++;
+  if (--sCallsBeforeClockCheck > 0) {
+    return false;
+  }
+
   static uint64_t t = Ion::Timing::millis();
-  static constexpr uint64_t delay = 100;
+  static uint64_t lastClockCheck = t;
 
   uint64_t t2 = Ion::Timing::millis();
-  if (t2 - t < delay) {
+  sStatistics.numberOfClockChecks++;
+  calibrateCallsBetweenClockChecks(t2 - lastClockCheck);
+  sCallsBeforeClockCheck = sCallsBetweenClockChecks;
+  lastClockCheck = t2;
+  if (t2 - t < k_refreshPeriod) {
     return false;
   }
   t = t2;
 
   micropython_port_vm_hook_refresh_print();
   // Check if the user asked for an interruption from the keyboard
-  return micropython_port_interrupt_if_needed();
+  bool interrupted = micropython_port_interrupt_if_needed();
+  // The refresh duration is not accounted for in the calibration
+  lastClockCheck = Ion::Timing::millis();
+  sStatistics.numberOfRefreshes++;
+  sStatistics.refreshDuration += lastClockCheck - t2;
+  return interrupted;
+}
+
+const micropython_port_vm_hook_statistics_t * micropython_port_vm_hook_statistics() {
+  return &sStatistics;
+}
+
+void micropython_port_reset_vm_hook_statistics() {
+  sStatistics = micropython_port_vm_hook_statistics_t();
+}
+
+void micropython_port_vm_hook_schedule_clock_check() {
+  sCallsBetweenClockChecks = 1;
+  sCallsBeforeClockCheck = 1;
 }
 
 void micropython_port_vm_hook_refresh_print() {
@@ -40,6 +95,9 @@ bool micropython_port_interruptible_msleep(int32_t delay) {
   const int32_t numberOfInterruptionChecks = delay / interruptionCheckDelay;
   int32_t remainingDelay = delay - numberOfInterruptionChecks * interruptionCheckDelay;
   int32_t currentRemainingInterruptionChecks = numberOfInterruptionChecks;
+  /* Calls to the VM hook are at least delay ms apart in a loop that sleeps, so
+   * the next call reads the clock whatever the calibration was. */
+  micropython_port_vm_hook_schedule_clock_check();
   do {
     // We assume the time taken by the interruption check is insignificant
     if (micropython_port_interrupt_if_needed()) {
@@ -11,9 +11,25 @@ extern "C" {
 // These methods return true if they have been interrupted
 bool micropython_port_vm_hook_loop();
 void micropython_port_vm_hook_refresh_print();
+// Make the next call to the VM hook read the clock
+void micropython_port_vm_hook_schedule_clock_check();
 bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
+// Whether the pages of the Python heap could be made executable
+bool micropython_port_heap_is_executable();
+
+/* Counters of the VM hook since the last reset. The refresh duration, in ms,
+ * covers the display refresh and the keyboard scan. */
+typedef struct {
+  uint64_t numberOfCalls;
+  uint32_t numberOfClockChecks;
+  uint32_t numberOfRefreshes;
+  uint32_t refreshDuration;
+} micropython_port_vm_hook_statistics_t;
+
+const micropython_port_vm_hook_statistics_t * micropython_port_vm_hook_statistics();
+void micropython_port_reset_vm_hook_statistics();
 
 #ifdef __cplusplus
 }
@@ -4,6 +4,7 @@ extern "C" {
 }
 #include "port.h"
 
+#include <ion/display.h>
 #include <kandinsky/ion_context.h>
 
 static mp_obj_t TupleForKDColor(KDColor c) {
@@ -84,3 +85,64 @@ mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
   KDIonContext::sharedContext()->fillRect(rect, color);
   return mp_const_none;
 }
+
+/* blit, get_rect and set_pixels exchange many pixels in one call, which saves
+ * the interpreter overhead of calling set_pixel for each of them. Buffers hold
+ * little-endian RGB565 colors, which is the layout of KDColor, row after row.
+ * The data of bytes and bytearray objects is allocated on the Python heap and
+ * is therefore aligned for KDColor. */
+
+static KDRect RectFromArguments(const mp_obj_t * args) {
+  mp_int_t width = mp_obj_get_int(args[2]);
+  mp_int_t height = mp_obj_get_int(args[3]);
+  if (width < 0 || height < 0) {
+    mp_raise_ValueError("Width and height must be positive");
+  }
+  return KDRect(mp_obj_get_int(args[0]), mp_obj_get_int(args[1]), width, height);
+}
+
+static void * PixelBuffer(mp_obj_t input, KDRect rect, mp_uint_t flags) {
+  mp_buffer_info_t bufferInfo;
+  mp_get_buffer_raise(input, &bufferInfo, flags);
+  if (bufferInfo.len < static_cast<size_t>(rect.width()) * rect.height() * sizeof(KDColor)) {
+    mp_raise_ValueError("Buffer is smaller than the rect");
+  }
+  if (reinterpret_cast<uintptr_t>(bufferInfo.buf) % alignof(KDColor) != 0) {
+    mp_raise_ValueError("Buffer is not aligned");
+  }
+  return bufferInfo.buf;
+}
+
+mp_obj_t modkandinsky_blit(size_t n_args, const mp_obj_t * args) {
+  KDRect rect = RectFromArguments(args);
+  const KDColor * pixels = static_cast<const KDColor *>(PixelBuffer(args[4], rect, MP_BUFFER_READ));
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDIonContext::sharedContext()->fillRectWithPixels(rect, pixels, nullptr);
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_get_rect(size_t n_args, const mp_obj_t * args) {
+  KDRect rect = RectFromArguments(args);
+  KDColor * pixels = static_cast<KDColor *>(PixelBuffer(args[4], rect, MP_BUFFER_WRITE));
+  KDIonContext::sharedContext()->getPixels(rect, pixels);
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_set_pixels(mp_obj_t x, mp_obj_t y, mp_obj_t colors) {
+  KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
+  size_t numberOfColors;
+  mp_obj_t * items;
+  mp_obj_get_array(colors, &numberOfColors, &items);
+  // Colors are parsed and pushed by chunks of a screen row
+  constexpr size_t k_bufferLength = Ion::Display::Width;
+  KDColor buffer[k_bufferLength];
+  for (size_t i = 0; i < numberOfColors; i += k_bufferLength) {
+    size_t length = numberOfColors - i < k_bufferLength ? numberOfColors - i : k_bufferLength;
+    for (size_t k = 0; k < length; k++) {
+      buffer[k] = MicroPython::Color::Parse(items[i + k]);
+    }
+    MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+    KDIonContext::sharedContext()->fillRectWithPixels(KDRect(point.x() + i, point.y(), length, 1), buffer, nullptr);
+  }
+  return mp_const_none;
+}
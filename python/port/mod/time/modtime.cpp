@@ -19,5 +19,6 @@ mp_obj_t modtime_sleep(mp_obj_t seconds_o) {
 }
 
 mp_obj_t modtime_monotonic() {
+    micropython_port_vm_hook_schedule_clock_check();
     return mp_obj_new_float(Ion::Timing::millis() / 1000.0);
 }
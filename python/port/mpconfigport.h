@@ -18,6 +18,16 @@
 #define MICROPY_ENABLE_PYSTACK (1)
 #endif
 
+#if defined(__x86_64__) && defined(__linux__)
+/* On the x64 Linux simulator, functions decorated with @micropython.native or
+ * @micropython.viper are compiled to machine code. The code is emitted on the
+ * Python heap, which MicroPython::init makes executable. If it cannot, these
+ * functions raise a NotImplementedError instead. The device keeps running
+ * bytecode only. */
+#define MICROPY_EMIT_X64 (1)
+#define MICROPY_PORT_NATIVE_CODE_IS_EXECUTABLE() micropython_port_heap_is_executable()
+#endif
+
 // Maximum length of a path in the filesystem
 #define MICROPY_ALLOC_PATH_MAX (32)
 
@@ -36,6 +46,15 @@
 // Whether to include information in the byte code to determine source
 #define MICROPY_ENABLE_SOURCE_LINE (1)
 
+#if !PLATFORM_DEVICE
+/* Whether to save compiled scripts and load them instead of their sources.
+ * The port then compiles the imported scripts, to load their saved bytecode.
+ * The device does not spend the flash the .mpy loader and saver take. */
+#define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_SAVE (1)
+#define MICROPY_PORT_COMPILE_FILE (1)
+#endif
+
 // Exception messages provide full info, e.g. object names
 #define MICROPY_ERROR_REPORTING (MICROPY_ERROR_REPORTING_DETAILED)
 
@@ -55,7 +74,7 @@
 #define MICROPY_PY_ASYNC_AWAIT (0)
 
 // Whether to support bytearray object
-#define MICROPY_PY_BUILTINS_BYTEARRAY (0)
+#define MICROPY_PY_BUILTINS_BYTEARRAY (1)
 
 // Whether to support frozenset object
 #define MICROPY_PY_BUILTINS_FROZENSET (1)
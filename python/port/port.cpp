@@ -7,6 +7,10 @@
 #include <stdint.h>
 #include <string.h>
 #include <setjmp.h>
+#if MICROPY_EMIT_X64
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 /* py/parsenum.h is a C header which uses C keyword restrict.
  * It does not exist in C++ so we define it here in order to be able to include
@@ -24,8 +28,10 @@ extern "C" {
 #include "py/mphal.h"
 #include "py/nlr.h"
 #include "py/parsenum.h"
+#include "py/persistentcode.h"
 #include "py/repl.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
 #include "py/stackctrl.h"
 #include "mphalport.h"
 #include "mod/turtle/modturtle.h"
@@ -45,6 +51,12 @@ MicroPython::ExecutionEnvironment * MicroPython::ExecutionEnvironment::currentEx
   return sCurrentExecutionEnvironment;
 }
 
+void MicroPython::ExecutionEnvironment::displaySandbox() {
+  // Drawing can be slow, the VM hook calibration is no longer valid
+  micropython_port_vm_hook_schedule_clock_check();
+  displayViewController(sandbox());
+}
+
 bool MicroPython::ExecutionEnvironment::runCode(const char * str) {
   assert(sCurrentExecutionEnvironment == nullptr);
   sCurrentExecutionEnvironment = this;
@@ -146,6 +158,37 @@ extern "C" {
   extern const void * _process_stack_end;
 }
 
+#if MICROPY_EMIT_X64
+/* Native code is emitted on the Python heap, so that the garbage collector
+ * keeps tracking the objects it refers to. The pages covering the heap are
+ * made executable while MicroPython runs. If mprotect fails, the compiler is
+ * told through micropython_port_heap_is_executable not to emit native code. */
+static void * sExecutablePagesStart = nullptr;
+static size_t sExecutablePagesLength = 0;
+
+static void setHeapExecutable(void * heapStart, void * heapEnd) {
+  uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+  uintptr_t start = reinterpret_cast<uintptr_t>(heapStart) & ~(pageSize - 1);
+  uintptr_t end = (reinterpret_cast<uintptr_t>(heapEnd) + pageSize - 1) & ~(pageSize - 1);
+  if (mprotect(reinterpret_cast<void *>(start), end - start, PROT_READ | PROT_WRITE | PROT_EXEC) == 0) {
+    sExecutablePagesStart = reinterpret_cast<void *>(start);
+    sExecutablePagesLength = end - start;
+  }
+}
+
+bool micropython_port_heap_is_executable() {
+  return sExecutablePagesStart != nullptr;
+}
+
+static void resetHeapExecutable() {
+  if (sExecutablePagesStart != nullptr) {
+    mprotect(sExecutablePagesStart, sExecutablePagesLength, PROT_READ | PROT_WRITE);
+    sExecutablePagesStart = nullptr;
+    sExecutablePagesLength = 0;
+  }
+}
+#endif
+
 void MicroPython::init(void * heapStart, void * heapEnd) {
 #if __EMSCRIPTEN__
   static mp_obj_t pystack[1024];
@@ -171,19 +214,39 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
    * device - and actually to be slightly less to be sure not to beat the device
    * performance.  */
   mp_stack_set_limit(29152);
+#endif
+#if MICROPY_EMIT_X64
+  setHeapExecutable(heapStart, heapEnd);
 #endif
   gc_init(heapStart, heapEnd);
   mp_init();
+  micropython_port_reset_vm_hook_statistics();
 }
 
 void MicroPython::deinit() {
   mp_deinit();
+#if MICROPY_EMIT_X64
+  resetHeapExecutable();
+#endif
 }
 
 void MicroPython::registerScriptProvider(ScriptProvider * s) {
   sScriptProvider = s;
 }
 
+bool MicroPython::destroyCompiledScripts(const Ion::Storage::Record recordToKeep) {
+  Ion::Storage::FileSystem * fileSystem = Ion::Storage::FileSystem::sharedFileSystem();
+  bool didDestroy = false;
+  for (int i = fileSystem->numberOfRecordsWithExtension(compiledScriptExtension) - 1; i >= 0; i--) {
+    Ion::Storage::Record record = fileSystem->recordWithExtensionAtIndex(compiledScriptExtension, i);
+    if (record != recordToKeep) {
+      record.destroy();
+      didDestroy = true;
+    }
+  }
+  return didDestroy;
+}
+
 void MicroPython::collectRootsAtAddress(char * address, int byteLength) {
   /* The given address is not necessarily aligned on sizeof(void *). However,
    * any pointer stored in the range [address, address + byteLength] will be
@@ -356,8 +419,86 @@ mp_import_stat_t mp_import_stat(const char *path) {
   return MP_IMPORT_STAT_NO_EXIST;
 }
 
+#if MICROPY_PORT_COMPILE_FILE
+
+/* Imported scripts are compiled once and their bytecode is stored by the
+ * script provider, which gives it back as long as the script is unchanged. */
+
+static uint32_t compilationKey(const char * content) {
+  /* Compiled scripts refer to the qstrs of the firmware by their index, so
+   * they are only valid with the firmware that compiled them. The storage can
+   * also be moved to a simulator built for another architecture, whose native
+   * code and small ints differ. */
+  const char * firmware = Ion::patchLevel();
+  uint32_t smallIntBits = 0;
+  for (mp_int_t i = MP_SMALL_INT_MAX; i != 0; i >>= 1) {
+    smallIntBits++;
+  }
+  uint32_t key[] = {
+    Ion::crc32Byte(reinterpret_cast<const uint8_t *>(content), strlen(content)),
+    Ion::crc32Byte(reinterpret_cast<const uint8_t *>(firmware), strlen(firmware)),
+    MP_QSTRnumber_of,
+    MPY_FILE_HEADER_INT,
+    smallIntBits
+  };
+  return Ion::crc32Word(key, sizeof(key)/sizeof(uint32_t));
+}
+
+static mp_raw_code_t * loadCompiledScript(const char * name, uint32_t key) {
+  size_t size;
+  const void * bytecode = sScriptProvider->compiledScript(name, key, &size);
+  if (bytecode == nullptr) {
+    return nullptr;
+  }
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    mp_raw_code_t * rawCode = mp_raw_code_load_mem(static_cast<const byte *>(bytecode), size);
+    nlr_pop();
+    return rawCode;
+  }
+  // The bytecode cannot be loaded, so the script is compiled again
+  sScriptProvider->destroyCompiledScript(name);
+  return nullptr;
+}
+
+static void storeCompiledScript(const char * name, uint32_t key, mp_raw_code_t * rawCode) {
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    vstr_t bytecode;
+    mp_print_t print;
+    vstr_init_print(&bytecode, 256, &print);
+    mp_raw_code_save(rawCode, &print);
+    sScriptProvider->storeCompiledScript(name, key, bytecode.buf, bytecode.len);
+    vstr_clear(&bytecode);
+    nlr_pop();
+  }
+  // If there is no memory left to save the bytecode, the script is not cached
+}
+
+mp_raw_code_t * mp_port_compile_file(const char * filename) {
+  const char * content = sScriptProvider != nullptr ? sScriptProvider->contentOfScript(filename, true) : nullptr;
+  if (content == nullptr) {
+    mp_raise_OSError(MP_ENOENT);
+  }
+  uint32_t key = compilationKey(content);
+  mp_raw_code_t * rawCode = loadCompiledScript(filename, key);
+  if (rawCode != nullptr) {
+    return rawCode;
+  }
+  mp_lexer_t * lex = mp_lexer_new_from_str_len(qstr_from_str(filename), content, strlen(content), 0);
+  // The lexer is freed by the parser
+  qstr sourceName = lex->source_name;
+  mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+  rawCode = mp_compile_to_raw_code(&parseTree, sourceName, false);
+  storeCompiledScript(filename, key, rawCode);
+  return rawCode;
+}
+
+#endif
+
 void mp_hal_stdout_tx_strn_cooked(const char * str, size_t len) {
   assert(sCurrentExecutionEnvironment != nullptr);
+  micropython_port_vm_hook_schedule_clock_check();
   sCurrentExecutionEnvironment->printText(str, len);
 }
 
@@ -7,6 +7,7 @@ extern "C" {
 #include "py/nlr.h"
 }
 #include <escher/view_controller.h>
+#include <ion/storage/record.h>
 
 
 namespace MicroPython {
@@ -14,6 +15,15 @@ namespace MicroPython {
 class ScriptProvider {
 public:
   virtual const char * contentOfScript(const char * name, bool markAsFetched) = 0;
+#if MICROPY_PORT_COMPILE_FILE
+  /* Imported scripts are compiled once and their bytecode is kept by the
+   * provider. The key identifies the content and the build the script was
+   * compiled with: compiledScript returns nullptr if the stored bytecode was
+   * saved with another key or has been altered since. */
+  virtual const void * compiledScript(const char * name, uint32_t key, size_t * size) { return nullptr; }
+  virtual bool storeCompiledScript(const char * name, uint32_t key, const void * data, size_t size) { return false; }
+  virtual void destroyCompiledScript(const char * name) {}
+#endif
 };
 
 class ExecutionEnvironment {
@@ -27,7 +37,7 @@ public:
   virtual const char * inputText(const char * prompt) { return nullptr; }
 
   // Sandbox
-  void displaySandbox() { displayViewController(sandbox()); }
+  void displaySandbox();
   virtual Escher::ViewController * sandbox() { return nullptr; }
   virtual void resetSandbox() {}
 
@@ -43,6 +53,12 @@ public:
 void init(void * heapStart, void * heapEnd);
 void deinit();
 void registerScriptProvider(ScriptProvider * s);
+
+/* Script providers store the bytecode of the imported scripts in records with
+ * this extension. These records are only a cache: they are destroyed, except
+ * recordToKeep, when other records need their space. */
+constexpr static char compiledScriptExtension[] = "mpy";
+bool destroyCompiledScripts(const Ion::Storage::Record recordToKeep = Ion::Storage::Record());
 void collectRootsAtAddress(char * address, int len);
 
 class Color {
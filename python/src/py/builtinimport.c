@@ -72,7 +72,10 @@ STATIC mp_import_stat_t stat_file_py_or_mpy(vstr_t *path) {
         return stat;
     }
 
-    #if MICROPY_PERSISTENT_CODE_LOAD
+    /* Warning: this is a NumWorks change to MicroPython 1.12. Only look for
+     * .mpy files when they can be read: the path might not have room for the
+     * extra character. */
+    #if MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER
     vstr_ins_byte(path, path->len - 2, 'm');
     stat = mp_import_stat_any(vstr_null_terminated_str(path));
     if (stat == MP_IMPORT_STAT_FILE) {
@@ -129,7 +132,7 @@ STATIC mp_import_stat_t find_file(const char *file_str, uint file_len, vstr_t *d
     return stat_dir_or_file(dest);
 }
 
-#if MICROPY_MODULE_FROZEN_STR || MICROPY_ENABLE_COMPILER
+#if MICROPY_MODULE_FROZEN_STR || (MICROPY_ENABLE_COMPILER && !MICROPY_PORT_COMPILE_FILE)
 STATIC void do_load_from_lexer(mp_obj_t module_obj, mp_lexer_t *lex) {
     #if MICROPY_PY___FILE__
     qstr source_name = lex->source_name;
@@ -142,7 +145,7 @@ STATIC void do_load_from_lexer(mp_obj_t module_obj, mp_lexer_t *lex) {
 }
 #endif
 
-#if (MICROPY_HAS_FILE_READER && MICROPY_PERSISTENT_CODE_LOAD) || MICROPY_MODULE_FROZEN_MPY
+#if (MICROPY_HAS_FILE_READER && MICROPY_PERSISTENT_CODE_LOAD) || MICROPY_MODULE_FROZEN_MPY || MICROPY_PORT_COMPILE_FILE
 STATIC void do_execute_raw_code(mp_obj_t module_obj, mp_raw_code_t *raw_code, const char *source_name) {
     (void)source_name;
 
@@ -219,8 +222,17 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     }
     #endif
 
+    /* Warning: this is a NumWorks change to MicroPython 1.12. If the port
+     * compiles the files, for instance to load their bytecode from a cache,
+     * then execute the compiled file. */
+    #if MICROPY_PORT_COMPILE_FILE
+    {
+        mp_raw_code_t *raw_code = mp_port_compile_file(file_str);
+        do_execute_raw_code(module_obj, raw_code, file_str);
+        return;
+    }
     // If we can compile scripts then load the file and compile and execute it.
-    #if MICROPY_ENABLE_COMPILER
+    #elif MICROPY_ENABLE_COMPILER
     {
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
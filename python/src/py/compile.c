@@ -856,6 +856,17 @@ STATIC bool compile_built_in_decorator(compiler_t *comp, size_t name_len, mp_par
         compile_syntax_error(comp, name_nodes[1], MP_ERROR_TEXT("invalid micropython decorator"));
     }
 
+    #if MICROPY_EMIT_NATIVE
+    /* Warning: this is a NumWorks change to MicroPython 1.12. If the port
+     * cannot execute native code, running it would crash, so the function is
+     * not compiled. */
+    if ((*emit_options == MP_EMIT_OPT_NATIVE_PYTHON || *emit_options == MP_EMIT_OPT_VIPER)
+        && !MICROPY_PORT_NATIVE_CODE_IS_EXECUTABLE() && comp->compile_error == MP_OBJ_NULL) {
+        comp->compile_error = mp_obj_new_exception_msg(&mp_type_NotImplementedError, MP_ERROR_TEXT("native code can't be executed"));
+        compile_error_set_line(comp, name_nodes[1]);
+    }
+    #endif
+
     #if MICROPY_DYNAMIC_COMPILER
     if (*emit_options == MP_EMIT_OPT_NATIVE_PYTHON || *emit_options == MP_EMIT_OPT_VIPER) {
         if (emit_native_table[mp_dynamic_compiler.native_arch] == NULL) {
@@ -535,6 +535,19 @@
 #define MICROPY_HAS_FILE_READER (MICROPY_READER_POSIX || MICROPY_READER_VFS)
 #endif
 
+// Whether the port compiles the imported files, with mp_port_compile_file
+// (this is a NumWorks change to MicroPython 1.12)
+#ifndef MICROPY_PORT_COMPILE_FILE
+#define MICROPY_PORT_COMPILE_FILE (0)
+#endif
+
+// Whether the port can execute the native code it emits, checked when
+// compiling a function decorated with a native emitter (this is a NumWorks
+// change to MicroPython 1.12)
+#ifndef MICROPY_PORT_NATIVE_CODE_IS_EXECUTABLE
+#define MICROPY_PORT_NATIVE_CODE_IS_EXECUTABLE() (1)
+#endif
+
 // Hook for the VM at the start of the opcode loop (can contain variable
 // definitions usable by the other hook functions)
 #ifndef MICROPY_VM_HOOK_INIT
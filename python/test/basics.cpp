@@ -7,6 +7,31 @@ QUIZ_CASE(python_basics) {
   deinit_environment();
 }
 
+QUIZ_CASE(python_native_emitter) {
+  const char * script = "@micropython.native\ndef f(n):\n  s = 0\n  for i in range(n):\n    s += i * 0.5\n  return s\n@micropython.viper\ndef g(n:int)->int:\n  s = 0\n  for i in range(n):\n    s += i\n  return s\nassert f(10) == 22.5\nassert g(10) == 45\n";
+#if MICROPY_EMIT_X64
+  assert_script_execution_succeeds(script);
+#else
+  // Without a native emitter, the decorators are invalid
+  assert_script_execution_fails(script);
+#endif
+}
+
+QUIZ_CASE(python_vm_hook) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "sum(i for i in range(10000))", "49995000\n");
+  const micropython_port_vm_hook_statistics_t * statistics = micropython_port_vm_hook_statistics();
+  quiz_assert(statistics->numberOfCalls >= 10000);
+  // The clock is not read on every backward jump
+  quiz_assert(statistics->numberOfClockChecks < statistics->numberOfCalls / 100);
+  // Reading the time makes the next call read the clock
+  assert_command_execution_succeeds(env, "import time");
+  micropython_port_reset_vm_hook_statistics();
+  assert_command_execution_succeeds(env, "len([time.monotonic() for i in range(100)])", "100\n");
+  quiz_assert(statistics->numberOfClockChecks >= 99);
+  deinit_environment();
+}
+
 QUIZ_CASE(python_template) {
   assert_script_execution_succeeds(Code::ScriptTemplate::Squares()->content());
   assert_script_execution_succeeds(Code::ScriptTemplate::Mandelbrot()->content());
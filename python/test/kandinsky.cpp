@@ -26,3 +26,20 @@ QUIZ_CASE(python_kandinsky_basics) {
   assert_command_execution_succeeds(env, "draw_string('hello',0,0)");
   deinit_environment();
 }
+
+QUIZ_CASE(python_kandinsky_buffers) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "b=bytearray(16)");
+  assert_command_execution_succeeds(env, "get_rect(0,0,4,2,b)");
+  assert_command_execution_succeeds(env, "blit(1,0,4,2,b)");
+  assert_command_execution_succeeds(env, "blit(1,0,2,1,bytes([31,0,224,7]))");
+  assert_command_execution_succeeds(env, "set_pixels(1,1,[(0,0,0),'white',color(0,255,0)])");
+  assert_command_execution_succeeds(env, "set_pixels(0,0,[(1,2,3)]*700)");
+  // Buffers must be large enough and writable for get_rect
+  assert_command_execution_fails(env, "blit(0,0,4,4,bytes(31))");
+  assert_command_execution_fails(env, "blit(0,0,-1,4,bytes(8))");
+  assert_command_execution_fails(env, "get_rect(0,0,1,1,bytes(2))");
+  assert_command_execution_fails(env, "set_pixels(0,0,[(0,0,0),'nocolor'])");
+  deinit_environment();
+}